@@ -0,0 +1,122 @@
+// Compares EnemySystem range/point queries against the old linear scan.
+// "grid" is the vector-returning API, "visit" and "span" the allocation-free ones.
+// Build from the repo root alongside the game sources, e.g.
+//   g++ -std=c++17 -O2 -Isrc bench/EnemyQueryBench.cpp src/systems/EnemySystem.cpp
+//       src/entities/Enemy.cpp src/components/SpriteComp.cpp src/core/EventBus.cpp
+//       src/utils/SpatialHash.cpp src/systems/FlowField.cpp src/systems/Grid.cpp
+//       -lsfml-graphics -lsfml-window -lsfml-system
+#include "../src/systems/EnemySystem.hpp"
+#include "../src/entities/Enemy.hpp"
+#include "../src/utils/QuietLog.hpp"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+namespace {
+
+// The pre-index implementation, kept here as the baseline
+size_t linearRangeCount(const std::vector<std::shared_ptr<Enemy>>& enemies,
+                        const sf::Vector2f& position, float range) {
+    std::vector<std::shared_ptr<Enemy>> result;
+    float rangeSq = range * range;
+    for (auto& enemy : enemies) {
+        if (!enemy->health->alive()) continue;
+        sf::Vector2f diff = enemy->transform->position - position;
+        if (diff.x * diff.x + diff.y * diff.y <= rangeSq) result.push_back(enemy);
+    }
+    return result.size();
+}
+
+std::shared_ptr<Enemy> linearAt(const std::vector<std::shared_ptr<Enemy>>& enemies,
+                                const sf::Vector2f& position, float radius) {
+    for (auto& enemy : enemies) {
+        if (!enemy->health->alive()) continue;
+        sf::Vector2f diff = enemy->transform->position - position;
+        float combinedRadius = enemy->collider->radius + radius;
+        if (diff.x * diff.x + diff.y * diff.y < combinedRadius * combinedRadius) return enemy;
+    }
+    return nullptr;
+}
+
+template<typename Fn>
+double nsPerQuery(int queries, Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < queries; ++i) fn(i);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / queries;
+}
+
+} // namespace
+
+int main() {
+    const float worldWidth = 1280.0f;
+    const float worldHeight = 960.0f;
+    const float towerRange = 150.0f;
+    const int queries = 4096;
+
+    std::cout << std::left << std::setw(10) << "enemies"
+              << std::setw(16) << "range linear" << std::setw(16) << "range grid"
+              << std::setw(16) << "range visit" << std::setw(16) << "range span"
+              << std::setw(16) << "point linear" << std::setw(16) << "point grid"
+              << "(ns/query)" << std::endl;
+
+    for (int count : {100, 1000, 10000}) {
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> x(0.0f, worldWidth);
+        std::uniform_real_distribution<float> y(0.0f, worldHeight);
+
+        // EnemySystem logs every add; keep the table readable
+        QuietLog quiet;
+        EnemySystem system;
+        for (int i = 0; i < count; ++i) {
+            auto enemy = std::make_shared<Enemy>();
+            enemy->initialize();
+            enemy->transform->position = sf::Vector2f(x(rng), y(rng));
+            system.add(enemy);
+        }
+        system.update(0.0f);
+        quiet.restore();
+
+        std::vector<sf::Vector2f> probes(queries);
+        for (auto& probe : probes) probe = sf::Vector2f(x(rng), y(rng));
+
+        size_t checksum = 0;
+        size_t mismatches = 0;
+        const auto& enemies = system.getEnemies();
+        double rangeLinear = nsPerQuery(queries, [&](int i) {
+            checksum += linearRangeCount(enemies, probes[i], towerRange);
+        });
+        double rangeGrid = nsPerQuery(queries, [&](int i) {
+            checksum -= system.getEnemiesInRange(probes[i], towerRange).size();
+        });
+        double rangeVisit = nsPerQuery(queries, [&](int i) {
+            size_t found = 0;
+            system.forEachEnemyInRange(probes[i], towerRange,
+                [&found](const std::shared_ptr<Enemy>&) { found++; });
+            checksum += found;
+        });
+        std::vector<Enemy*> scratch(count);
+        double rangeSpan = nsPerQuery(queries, [&](int i) {
+            checksum -= system.getEnemiesInRange(probes[i], towerRange, scratch.data(), scratch.size());
+        });
+        double pointLinear = nsPerQuery(queries, [&](int i) {
+            checksum += linearAt(enemies, probes[i], 8.0f) != nullptr;
+        });
+        double pointGrid = nsPerQuery(queries, [&](int i) {
+            checksum -= system.getEnemyAtPosition(probes[i], 8.0f) != nullptr;
+        });
+        for (int i = 0; i < queries; ++i) {
+            if (linearAt(enemies, probes[i], 8.0f) != system.getEnemyAtPosition(probes[i], 8.0f)) {
+                mismatches++;
+            }
+        }
+
+        std::cout << std::fixed << std::setprecision(1) << std::setw(10) << count
+                  << std::setw(16) << rangeLinear << std::setw(16) << rangeGrid
+                  << std::setw(16) << rangeVisit << std::setw(16) << rangeSpan
+                  << std::setw(16) << pointLinear << std::setw(16) << pointGrid
+                  << (checksum == 0 && mismatches == 0 ? "" : "RESULT MISMATCH") << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,104 @@
+// Times EnemySystem/UnitSystem/TowerSystem updates over 5k live entities
+// (4000 enemies, 500 units, 500 towers). Nothing dies, so every tick does the
+// same work. Build from the repo root alongside the game sources, e.g.
+//   g++ -std=c++17 -O2 -Isrc bench/EntityTickBench.cpp src/systems/EnemySystem.cpp
+//       src/systems/UnitSystem.cpp src/systems/TowerSystem.cpp src/systems/ProjectileSystem.cpp
+//       src/systems/ParticleSystem.cpp src/entities/Enemy.cpp src/entities/Unit.cpp
+//       src/entities/Tower.cpp src/components/SpriteComp.cpp src/core/EventBus.cpp
+//       src/systems/CollisionSystem.cpp src/systems/FlowField.cpp src/systems/Grid.cpp
+//       src/systems/PathRegistry.cpp src/systems/ProjectileKinematics.cpp
+//       src/utils/SpatialHash.cpp src/utils/Random.cpp
+//       -lsfml-graphics -lsfml-window -lsfml-system
+// Cache behaviour: run the binary under `perf stat -e cache-references,cache-misses`.
+#include "../src/systems/EnemySystem.hpp"
+#include "../src/systems/UnitSystem.hpp"
+#include "../src/systems/TowerSystem.hpp"
+#include "../src/systems/ProjectileSystem.hpp"
+#include "../src/systems/PathRegistry.hpp"
+#include "../src/entities/Enemy.hpp"
+#include "../src/entities/Tower.hpp"
+#include "../src/utils/QuietLog.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+int main() {
+    const int enemyCount = 4000;
+    const int unitCount = 500;
+    const int towerCount = 500;
+    const int warmupTicks = 50;
+    const int ticks = 500;
+    const float dt = 1.0f / 60.0f;
+
+    QuietLog quiet;
+
+    EnemySystem enemies;
+    UnitSystem units;
+    TowerSystem towers;
+    ProjectileSystem projectiles;
+    enemies.initialize(&projectiles, &units);
+    units.initialize(&enemies, &projectiles);
+    towers.initialize(&enemies, &projectiles);
+    projectiles.initialize(&enemies, nullptr);
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> x(0.0f, 1280.0f);
+    std::uniform_real_distribution<float> y(0.0f, 960.0f);
+
+    PathRegistry routes;
+    // Interleave allocations the way a running game does
+    for (int i = 0; i < enemyCount; ++i) {
+        auto enemy = std::make_shared<Enemy>();
+        enemy->initialize();
+        enemy->health->hp = enemy->health->maxHp = 1000000000;
+        enemy->transform->position = sf::Vector2f(x(rng), y(rng));
+        // Long back-and-forth route so nobody finishes during the run
+        std::vector<sf::Vector2f> route;
+        for (int w = 0; w < 64; ++w) {
+            route.push_back(sf::Vector2f(x(rng), y(rng)));
+        }
+        enemy->path->setRoute(routes.intern(route));
+        enemies.add(enemy);
+        if (i % 8 == 0 && i / 8 < unitCount) {
+            auto unit = std::make_shared<Unit>();
+            unit->initialize();
+            unit->health->hp = unit->health->maxHp = 1000000000;
+            unit->ai->melee = (i / 8) % 2 == 0;
+            unit->transform->position = sf::Vector2f(x(rng), y(rng));
+            units.add(unit);
+        }
+        if (i % 8 == 4 && i / 8 < towerCount) {
+            auto tower = std::make_shared<Tower>();
+            tower->initialize();
+            tower->transform->position = sf::Vector2f(x(rng), y(rng));
+            towers.add(tower);
+        }
+    }
+
+    std::vector<double> samples;
+    samples.reserve(ticks);
+    for (int tick = 0; tick < warmupTicks + ticks; ++tick) {
+        auto start = std::chrono::steady_clock::now();
+        enemies.update(dt);
+        units.update(dt);
+        towers.update(dt);
+        auto end = std::chrono::steady_clock::now();
+        if (tick >= warmupTicks) {
+            samples.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+        }
+        // Keep the projectile pool from saturating so towers keep firing
+        if (tick % 10 == 0) projectiles.clear();
+    }
+    quiet.restore();
+
+    std::sort(samples.begin(), samples.end());
+    double median = samples[samples.size() / 2];
+    double p95 = samples[samples.size() * 95 / 100];
+    std::cout << std::fixed << std::setprecision(1)
+              << "entities " << (enemyCount + unitCount + towerCount)
+              << "  median " << median << " us/tick"
+              << "  p95 " << p95 << " us/tick" << std::endl;
+    return 0;
+}
@@ -0,0 +1,140 @@
+#pragma once
+// Minimal micro-benchmark harness: warm-up, timed repetitions, median/p95 per
+// repetition and ns/op, plus a JSON dump so runs can be diffed.
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../src/utils/QuietLog.hpp"
+
+namespace bench {
+
+// Keeps the optimizer from discarding a result
+template<typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+struct Result {
+    std::string name;
+    std::string params;
+    size_t opsPerRep;
+    int warmup;
+    int repetitions;
+    double medianNs;  // per repetition
+    double p95Ns;
+    double nsPerOp;   // median / opsPerRep
+    std::vector<std::pair<std::string, double>> counters;  // extra per-benchmark figures
+};
+
+class Harness {
+public:
+    Harness(int warmup = 3, int repetitions = 15) : warmup_(warmup), repetitions_(repetitions) {}
+
+    // Only benchmarks whose "name/params" contains filter run
+    void setFilter(const std::string& filter) { filter_ = filter; }
+    void setRepetitions(int repetitions) { repetitions_ = repetitions; }
+
+    // setup() runs untimed before every repetition; body() is the timed work
+    // and performs opsPerRep operations. repetitions <= 0 uses the default.
+    void run(const std::string& name, const std::string& params, size_t opsPerRep,
+             const std::function<void()>& setup, const std::function<void()>& body,
+             int repetitions = 0) {
+        std::string label = name + "/" + params;
+        skipped_ = !filter_.empty() && label.find(filter_) == std::string::npos;
+        if (skipped_) return;
+        int reps = repetitions > 0 ? std::min(repetitions, repetitions_) : repetitions_;
+        int warm = std::min(warmup_, reps);
+
+        // The game systems log freely; drop that without touching the timing much
+        QuietLog quiet;
+        std::vector<double> samples;
+        samples.reserve(reps);
+        for (int i = 0; i < warm + reps; ++i) {
+            if (setup) setup();
+            auto start = std::chrono::steady_clock::now();
+            body();
+            auto end = std::chrono::steady_clock::now();
+            if (i >= warm) samples.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+        }
+        quiet.restore();
+
+        std::sort(samples.begin(), samples.end());
+        Result result;
+        result.name = name;
+        result.params = params;
+        result.opsPerRep = opsPerRep;
+        result.warmup = warm;
+        result.repetitions = reps;
+        result.medianNs = samples[samples.size() / 2];
+        result.p95Ns = samples[std::min(samples.size() - 1, samples.size() * 95 / 100)];
+        result.nsPerOp = result.medianNs / static_cast<double>(opsPerRep ? opsPerRep : 1);
+        results_.push_back(result);
+        printRow(result);
+    }
+
+    void run(const std::string& name, const std::string& params, size_t opsPerRep,
+             const std::function<void()>& body, int repetitions = 0) {
+        run(name, params, opsPerRep, nullptr, body, repetitions);
+    }
+
+    // Attaches a named figure (e.g. nodes expanded) to the last benchmark run
+    void addCounter(const std::string& name, double value) {
+        if (results_.empty() || skipped_) return;
+        results_.back().counters.emplace_back(name, value);
+        std::cout << "    " << name << " = " << std::fixed << std::setprecision(0) << value << std::endl;
+    }
+
+    void printHeader() const {
+        std::cout << std::left << std::setw(32) << "benchmark" << std::setw(16) << "params"
+                  << std::right << std::setw(14) << "median us" << std::setw(14) << "p95 us"
+                  << std::setw(14) << "ns/op" << std::endl;
+    }
+
+    void writeJson(std::ostream& out) const {
+        out << "{\n  \"benchmarks\": [\n";
+        for (size_t i = 0; i < results_.size(); ++i) {
+            const Result& r = results_[i];
+            out << std::fixed << std::setprecision(1)
+                << "    {\"name\": \"" << r.name << "\", \"params\": \"" << r.params << "\""
+                << ", \"ops_per_rep\": " << r.opsPerRep << ", \"warmup\": " << r.warmup
+                << ", \"repetitions\": " << r.repetitions
+                << ", \"median_ns\": " << r.medianNs << ", \"p95_ns\": " << r.p95Ns
+                << ", \"ns_per_op\": " << std::setprecision(3) << r.nsPerOp;
+            for (const auto& counter : r.counters) {
+                out << ", \"" << counter.first << "\": " << std::setprecision(0) << counter.second;
+            }
+            out << "}"
+                << (i + 1 < results_.size() ? "," : "") << "\n";
+        }
+        out << "  ]\n}\n";
+    }
+
+    const std::vector<Result>& results() const { return results_; }
+
+private:
+    void printRow(const Result& r) const {
+        std::cout << std::left << std::setw(32) << r.name << std::setw(16) << r.params << std::right
+                  << std::fixed << std::setprecision(1) << std::setw(14) << r.medianNs / 1000.0
+                  << std::setw(14) << r.p95Ns / 1000.0 << std::setprecision(2) << std::setw(14) << r.nsPerOp
+                  << std::endl;
+    }
+
+    int warmup_;
+    int repetitions_;
+    std::string filter_;
+    bool skipped_ = false;
+    std::vector<Result> results_;
+};
+
+} // namespace bench
@@ -0,0 +1,652 @@
+// Micro-benchmarks for the simulation hot paths: pathfinding, projectile and
+// particle updates, enemy range queries, event fan-out and data loading.
+// Prints a table and writes JSON (default bench_results.json) for diffing runs.
+// Build from the repo root alongside the game sources, e.g.
+//   g++ -std=c++17 -O2 -pthread -Isrc bench/HotPathBench.cpp src/systems/PathfindingSystem.cpp
+//       src/systems/HierarchicalPathfinder.cpp src/systems/PathRequestQueue.cpp
+//       src/systems/PathRegistry.cpp src/systems/Grid.cpp src/systems/ProjectileSystem.cpp
+//       src/systems/ProjectileKinematics.cpp src/systems/ParticleSystem.cpp src/systems/EnemySystem.cpp
+//       src/systems/FlowField.cpp src/systems/CollisionSystem.cpp
+//       src/entities/Enemy.cpp src/components/SpriteComp.cpp
+//       src/core/EventBus.cpp src/json/JSONLoader.cpp src/maps/Map.cpp src/utils/*.cpp
+//       -lsfml-graphics -lsfml-window -lsfml-system
+// Usage: HotPathBench [--json out.json] [--filter text] [--reps N]
+// Run from the repo root so JSONLoader finds data/.
+// Exits 1 before benchmarking if HIERARCHICAL and ASTAR disagree on whether
+// a route exists.
+#include "Harness.hpp"
+#include "../src/systems/PathfindingSystem.hpp"
+#include "../src/systems/HierarchicalPathfinder.hpp"
+#include "../src/systems/FlowField.hpp"
+#include "../src/systems/PathRequestQueue.hpp"
+#include "../src/systems/PathRegistry.hpp"
+#include "../src/components/PathFollower.hpp"
+#include "../src/systems/ProjectileSystem.hpp"
+#include "../src/systems/ParticleSystem.hpp"
+#include "../src/systems/EnemySystem.hpp"
+#include "../src/entities/Enemy.hpp"
+#include "../src/core/EventBus.hpp"
+#include "../src/json/JSONLoader.hpp"
+#include "../src/json/json.hpp"
+#include "../src/maps/Map.hpp"
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <sstream>
+
+namespace {
+
+const float kTile = 32.0f;
+
+// Vertical walls every 8 columns with a gap alternating top/bottom, so the
+// route from corner to corner has to snake across the whole grid
+void buildMaze(Grid& grid) {
+    for (int x = 4; x < grid.getWidth() - 1; x += 8) {
+        bool gapAtTop = (x / 8) % 2 == 0;
+        for (int y = 0; y < grid.getHeight(); ++y) {
+            bool gap = gapAtTop ? y < 2 : y >= grid.getHeight() - 2;
+            if (!gap) grid.setWalkable(x, y, false);
+        }
+    }
+}
+
+void benchPathfinding(bench::Harness& harness) {
+    const int sizes[][2] = { {20, 15}, {64, 64}, {128, 128}, {256, 256} };
+    for (const auto& size : sizes) {
+        int cols = size[0], rows = size[1];
+        PathfindingSystem pathfinding;
+        pathfinding.initialize(cols, rows, kTile);
+        pathfinding.setCacheCapacity(0);  // measure the search itself
+        buildMaze(*pathfinding.getGrid());
+        Vec2 start(kTile * 0.5f, kTile * 0.5f);
+        Vec2 goal((cols - 0.5f) * kTile, (rows - 0.5f) * kTile);
+        std::string params = std::to_string(cols) + "x" + std::to_string(rows);
+        harness.run("PathfindingSystem::findPath", params, 1, [&]() {
+            auto path = pathfinding.findPath(start, goal);
+            bench::doNotOptimize(path);
+        }, cols * rows > 100000 ? 5 : 0);
+    }
+
+    // The same 256x256 maze query through the request queue: what the main
+    // thread pays to issue it, and the full round trip to delivery
+    {
+        PathfindingSystem source;
+        source.initialize(256, 256, kTile);
+        buildMaze(*source.getGrid());
+        PathRequestQueue queue;
+        queue.setGrid(source.getGrid());
+        Vec2 start(kTile * 0.5f, kTile * 0.5f);
+        // A different goal each time so the workers' path caches never answer
+        std::vector<Vec2> goals;
+        for (int x = 255; x >= 0 && goals.size() < 128; --x) {
+            if (source.getGrid()->isWalkable(x, 255)) goals.emplace_back((x + 0.5f) * kTile, 255.5f * kTile);
+        }
+        size_t next = 0;
+        size_t points = 0;
+        auto onReady = [&points](const PathRequestQueue::Result& result) { points = result.path.size(); };
+        harness.run("PathRequestQueue::request", "256x256", 1, [&]() {
+            queue.waitIdle();
+            queue.deliver();
+        }, [&]() {
+            queue.request(start, goals[next++ % goals.size()], onReady);
+        }, 5);
+        harness.run("PathRequestQueue round trip", "256x256", 1, [&]() {
+            queue.request(start, goals[next++ % goals.size()], onReady);
+            queue.waitIdle();
+            queue.deliver();
+        }, 5);
+        harness.addCounter("workers", queue.getWorkerCount());
+        harness.addCounter("path_points", static_cast<double>(points));
+    }
+
+    // A wave of 50 enemies asking for the same route from a cold cache:
+    // one search, then 49 hits
+    PathfindingSystem pathfinding;
+    pathfinding.initialize(64, 64, kTile);
+    buildMaze(*pathfinding.getGrid());
+    Vec2 start(kTile * 0.5f, kTile * 0.5f);
+    Vec2 goal(63.5f * kTile, 63.5f * kTile);
+    const int burst = 50;
+    harness.run("PathfindingSystem::findPath", "64x64 burst=50", burst, [&]() {
+        pathfinding.clearCache();
+    }, [&]() {
+        for (int i = 0; i < burst; ++i) {
+            auto path = pathfinding.findPath(start, goal);
+            bench::doNotOptimize(path);
+        }
+    });
+}
+
+// Open field with scattered 1x1 to 3x3 obstacles; the corners stay open so
+// corner-to-corner queries are well defined
+void scatterObstacles(Grid& grid) {
+    const int width = grid.getWidth(), height = grid.getHeight();
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> column(0, width - 1);
+    std::uniform_int_distribution<int> row(0, height - 1);
+    std::uniform_int_distribution<int> extent(1, 3);
+    for (int i = 0; i < width * height / 12; ++i) {
+        int x = column(rng), y = row(rng), w = extent(rng), h = extent(rng);
+        for (int dy = 0; dy < h; ++dy) {
+            for (int dx = 0; dx < w; ++dx) grid.setWalkable(x + dx, y + dy, false);
+        }
+    }
+    for (int dy = 0; dy < 2; ++dy) {
+        for (int dx = 0; dx < 2; ++dx) {
+            grid.setWalkable(dx, dy, true);
+            grid.setWalkable(width - 1 - dx, height - 1 - dy, true);
+        }
+    }
+}
+
+// Walkability queries on the bitset grid: line of sight between random open
+// cells (the smoothing and cache revalidation hot path) and full-grid scans
+void benchGrid(bench::Harness& harness) {
+    PathfindingSystem pathfinding;
+    pathfinding.initialize(256, 256, kTile);
+    Grid& grid = *pathfinding.getGrid();
+    scatterObstacles(grid);
+    std::mt19937 rng(5);
+    // Smoothing-length segments, up to 16 cells each way
+    std::uniform_real_distribution<float> coord(16.0f * kTile, 240.0f * kTile);
+    std::uniform_real_distribution<float> offset(-16.0f * kTile, 16.0f * kTile);
+    std::vector<std::pair<Vec2, Vec2>> segments(4096);
+    for (auto& segment : segments) {
+        Vec2 from(coord(rng), coord(rng));
+        segment = { from, from + Vec2(offset(rng), offset(rng)) };
+    }
+    size_t visible = 0;
+    harness.run("PathfindingSystem::lineOfSight", "256x256", segments.size(), [&]() {
+        visible = 0;
+        for (const auto& segment : segments) visible += pathfinding.lineOfSight(segment.first, segment.second);
+        bench::doNotOptimize(visible);
+    });
+    harness.addCounter("visible", static_cast<double>(visible));
+
+    // Map-spanning sight lines over open ground, where whole rows of cells
+    // are tested per word
+    PathfindingSystem open;
+    open.initialize(1024, 1024, kTile);
+    std::uniform_real_distribution<float> anywhere(0.0f, 1024.0f * kTile);
+    for (auto& segment : segments) segment = { Vec2(anywhere(rng), anywhere(rng)), Vec2(anywhere(rng), anywhere(rng)) };
+    harness.run("PathfindingSystem::lineOfSight", "1024x1024 open", segments.size(), [&]() {
+        visible = 0;
+        for (const auto& segment : segments) visible += open.lineOfSight(segment.first, segment.second);
+        bench::doNotOptimize(visible);
+    });
+
+    // Long straight probes: what simplifyPath asks of a freshly found route
+    std::vector<Vec2> route = pathfinding.findPath(Vec2(kTile * 0.5f, kTile * 0.5f), Vec2(255.5f * kTile, 255.5f * kTile));
+    harness.run("PathfindingSystem::simplifyPath", "256x256", 1, [&]() {
+        auto simplified = pathfinding.simplifyPath(route);
+        bench::doNotOptimize(simplified);
+    });
+    harness.addCounter("route_points", static_cast<double>(route.size()));
+
+    Grid large(4096, 4096, kTile);
+    harness.run("Grid::neighborhood scan", "4096x4096", 4096u * 4096u, [&]() {
+        uint32_t open = 0;
+        for (int y = 0; y < 4096; ++y) {
+            for (int x = 0; x < 4096; ++x) open += large.neighborhood(x, y) & 1u;
+        }
+        bench::doNotOptimize(open);
+    }, 3);
+    harness.addCounter("grid_bytes", static_cast<double>(large.getMemoryBytes()));
+}
+
+// A* against jump point search on the same query: latency plus the nodes each
+// pops from its open list. Results are uncached so every rep is a full search.
+void compareSearchModes(bench::Harness& harness, PathfindingSystem& pathfinding,
+                        const std::string& params, const Vec2& start, const Vec2& goal, int repetitions) {
+    pathfinding.setCacheCapacity(0);
+    pathfinding.buildHierarchy();  // timed separately, in benchHierarchical
+    const std::pair<PathfindingSystem::SearchMode, const char*> modes[] = {
+        { PathfindingSystem::SearchMode::ASTAR, "astar" },
+        { PathfindingSystem::SearchMode::JUMP_POINT, "jps" },
+        { PathfindingSystem::SearchMode::HIERARCHICAL, "hpa" },
+    };
+    for (const auto& mode : modes) {
+        harness.run("findPath search mode", params + " " + mode.second, 1, [&]() {
+            auto path = pathfinding.findPath(start, goal, mode.first);
+            bench::doNotOptimize(path);
+        }, repetitions);
+        pathfinding.findPath(start, goal, mode.first);
+        harness.addCounter("expansions", static_cast<double>(pathfinding.getLastExpansions()));
+        harness.addCounter("path_cells", static_cast<double>(pathfinding.getLastPath().size()));
+    }
+}
+
+void benchSearchModes(bench::Harness& harness) {
+    // Every map in maps.json, spawn to goal. Waypoint maps only mark the
+    // tiles around each waypoint, so their route is widened into a 3-cell
+    // corridor between consecutive waypoints to give the search a real maze.
+    std::ifstream file("data/maps.json");
+    nlohmann::json maps;
+    if (file.is_open()) file >> maps;
+    for (const auto& entry : maps.value("maps", nlohmann::json::array())) {
+        std::string id = entry.value("id", std::string());
+        Map map;
+        QuietLog quiet;
+        bool loaded = map.loadFromJSON(nullptr, id);
+        quiet.restore();
+        if (!loaded) continue;
+        PathfindingSystem pathfinding;
+        pathfinding.initialize(map.cols(), map.rows(), map.tileSize());
+        for (int y = 0; y < map.rows(); ++y) {
+            for (int x = 0; x < map.cols(); ++x) {
+                pathfinding.getGrid()->setWalkable(x, y, map.isWalkable(x, y));
+            }
+        }
+        const auto& route = map.getPath();
+        for (size_t i = 0; i + 1 < route.size(); ++i) {
+            sf::Vector2i from = pathfinding.getGrid()->worldToGrid(route[i]);
+            sf::Vector2i to = pathfinding.getGrid()->worldToGrid(route[i + 1]);
+            for (int y = std::min(from.y, to.y) - 1; y <= std::max(from.y, to.y) + 1; ++y) {
+                for (int x = std::min(from.x, to.x) - 1; x <= std::max(from.x, to.x) + 1; ++x) {
+                    if (from.x == to.x || from.y == to.y) pathfinding.getGrid()->setWalkable(x, y, true);
+                }
+            }
+        }
+        compareSearchModes(harness, pathfinding, id, map.getSpawnPoint(), map.getEndPoint(), 0);
+    }
+
+    // Generated open fields with scattered 1x1 to 3x3 obstacles
+    for (int size : {256, 1024}) {
+        PathfindingSystem pathfinding;
+        pathfinding.initialize(size, size, kTile);
+        scatterObstacles(*pathfinding.getGrid());
+        std::string params = std::to_string(size) + "x" + std::to_string(size);
+        Vec2 start(kTile * 0.5f, kTile * 0.5f);
+        Vec2 goal((size - 0.5f) * kTile, (size - 0.5f) * kTile);
+        compareSearchModes(harness, pathfinding, params, start, goal, size >= 1024 ? 3 : 0);
+    }
+}
+
+// HPA* on a 1024x1024 field: building the graph, an abstract query with just
+// the first segment refined (what a walker needs to start moving), and the
+// incremental rebuild after a tower-sized edit
+void benchHierarchical(bench::Harness& harness) {
+    const int size = 1024;
+    Grid grid(size, size, kTile);
+    scatterObstacles(grid);
+    std::unique_ptr<HierarchicalPathfinder> hierarchy;
+    harness.run("HPA* build", "1024x1024 cluster=32", 1, [&]() {
+        hierarchy = std::make_unique<HierarchicalPathfinder>(grid, 32);
+    }, 3);
+    if (!hierarchy) hierarchy = std::make_unique<HierarchicalPathfinder>(grid, 32);
+    harness.addCounter("nodes", static_cast<double>(hierarchy->getNodeCount()));
+
+    std::mt19937 rng(99);
+    std::uniform_int_distribution<int> coord(0, size - 1);
+    std::vector<std::pair<int, int>> queries;
+    while (queries.size() < 16) {
+        int a = coord(rng) * size + coord(rng);
+        int b = coord(rng) * size + coord(rng);
+        if (grid.isWalkable(a % size, a / size) && grid.isWalkable(b % size, b / size)) queries.emplace_back(a, b);
+    }
+    std::vector<int> waypoints, cells;
+    size_t expansions = 0;
+    harness.run("HPA* query + first segment", "1024x1024", queries.size(), [&]() {
+        expansions = 0;
+        for (const auto& query : queries) {
+            cells.clear();
+            if (hierarchy->findAbstractPath(query.first, query.second, waypoints) && waypoints.size() > 1) {
+                hierarchy->refineSegment(waypoints[0], waypoints[1], cells);
+            }
+            expansions += hierarchy->getLastExpansions();
+            bench::doNotOptimize(cells);
+        }
+    });
+    harness.addCounter("expansions_per_query", static_cast<double>(expansions / queries.size()));
+    harness.run("HPA* full refine", "1024x1024", queries.size(), [&]() {
+        for (const auto& query : queries) {
+            hierarchy->findPath(query.first, query.second, cells);
+            bench::doNotOptimize(cells);
+        }
+    });
+
+    int toggle = 0;
+    harness.run("HPA* update after edit", "1024x1024", 1, [&]() {
+        grid.setWalkable(500, 500 + (toggle % 2), toggle % 4 < 2);
+        toggle++;
+    }, [&]() {
+        hierarchy->update();
+    });
+    harness.addCounter("clusters_rebuilt", static_cast<double>(hierarchy->getClustersRebuilt()));
+}
+
+// HPA* must find a route exactly when A* does. Small random grids with small
+// clusters put many walls on cluster borders, including gaps only a
+// diagonal step gets through; edits between queries exercise update().
+// Returns the number of queries where the two disagree.
+int checkHierarchicalReachability() {
+    std::mt19937 rng(5);
+    int queries = 0;
+    int mismatches = 0;
+    for (int trial = 0; trial < 40; ++trial) {
+        const int cols = 8 + static_cast<int>(rng() % 40);
+        const int rows = 8 + static_cast<int>(rng() % 40);
+        PathfindingSystem pathfinding;
+        pathfinding.initialize(cols, rows, kTile);
+        pathfinding.setCacheCapacity(0);
+        pathfinding.setClusterSize(4 + static_cast<int>(rng() % 5));
+        std::uniform_real_distribution<float> chance(0.0f, 1.0f);
+        const float density = 0.2f + 0.4f * chance(rng);
+        for (int y = 0; y < rows; ++y) {
+            for (int x = 0; x < cols; ++x) {
+                if (chance(rng) < density) pathfinding.getGrid()->setWalkable(x, y, false);
+            }
+        }
+        pathfinding.buildHierarchy();
+        for (int i = 0; i < 100; ++i) {
+            if (i % 10 == 0) {
+                for (int edit = 0; edit < 5; ++edit) {
+                    pathfinding.getGrid()->setWalkable(rng() % cols, rng() % rows, rng() % 2 == 0);
+                }
+            }
+            Vec2 start((rng() % cols + 0.5f) * kTile, (rng() % rows + 0.5f) * kTile);
+            Vec2 goal((rng() % cols + 0.5f) * kTile, (rng() % rows + 0.5f) * kTile);
+            bool hierarchical = !pathfinding.findPath(start, goal, PathfindingSystem::SearchMode::HIERARCHICAL).empty();
+            bool astar = !pathfinding.findPath(start, goal, PathfindingSystem::SearchMode::ASTAR).empty();
+            queries++;
+            if (hierarchical != astar) mismatches++;
+        }
+    }
+    std::cout << "HPA* reachability: " << queries - mismatches << "/" << queries << " queries agree with A*" << std::endl;
+    return mismatches;
+}
+
+// Flow field after a tower lands: full rebuild against the incremental repair,
+// on an open field and with the tower cutting across the current best route
+void benchFlowFieldRepair(bench::Harness& harness) {
+    for (int size : { 64, 256 }) {
+        Grid grid(size, size, kTile);
+        scatterObstacles(grid);
+        const sf::Vector2f goal(kTile * 0.5f, kTile * 0.5f);
+        FlowField field;
+        field.build(grid, goal);
+        // A cell on the route from the far corner, so blocking it forces a detour
+        sf::Vector2f probe(kTile * (size - 0.5f), kTile * (size - 0.5f));
+        for (int i = 0; i < size / 2; ++i) {
+            probe += field.directionAt(probe) * kTile;
+        }
+        sf::Vector2i onRoute = grid.worldToGrid(probe);
+        std::string params = std::to_string(size) + "x" + std::to_string(size);
+        bool blocked = false;
+        harness.run("flow field rebuild", params, 1, [&]() {
+            blocked = !blocked;
+            grid.setWalkable(onRoute.x, onRoute.y, !blocked);
+        }, [&]() {
+            field.build(grid, goal);
+        });
+        harness.addCounter("cells", static_cast<double>(field.getLastUpdatedCells()));
+        // Placing the tower (raised distances) and selling it (lowered) separately
+        for (bool place : { true, false }) {
+            harness.run("flow field repair", params + (place ? " place" : " sell"), 1, [&]() {
+                grid.setWalkable(onRoute.x, onRoute.y, place);
+                field.rebuildIfStale(grid);
+                grid.setWalkable(onRoute.x, onRoute.y, !place);
+            }, [&]() {
+                field.rebuildIfStale(grid);
+            });
+            harness.addCounter("cells", static_cast<double>(field.getLastUpdatedCells()));
+        }
+    }
+}
+
+void benchProjectiles(bench::Harness& harness) {
+    // Full pools, then a big pool with few shots in flight: update cost
+    // follows the live count, not the capacity
+    const std::vector<std::pair<size_t, size_t>> cases = {
+        {256, 256}, {1024, 1024}, {4096, 4096}, {16384, 16384}, {65536, 65536}, {100000, 100000}, {65536, 1024}};
+    for (const auto& sizes : cases) {
+        size_t poolSize = sizes.first;
+        size_t live = sizes.second;
+        ProjectileSystem projectiles(poolSize);
+        projectiles.initialize(nullptr, nullptr);
+        int arrow = projectiles.registerArchetype("arrow_tower", "projectiles/arrow", 400.0f);
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+        for (size_t i = 0; i < live; ++i) {
+            float a = angle(rng);
+            projectiles.fire(arrow, sf::Vector2f(640.0f, 480.0f), sf::Vector2f(std::cos(a), std::sin(a)), 1);
+        }
+        // Tiny steps keep every projectile in flight for the whole run
+        std::string params = "pool=" + std::to_string(poolSize);
+        if (live != poolSize) params += " live=" + std::to_string(live);
+        harness.run("ProjectileSystem::update", params, live, [&]() {
+            projectiles.update(0.0001f);
+        });
+    }
+
+    const std::vector<std::pair<std::string, std::string>> towers = {
+        {"arrow_tower", "projectiles/arrow"}, {"cannon_tower", "projectiles/cannonball"},
+        {"mage_tower", "projectiles/fireball"}, {"ice_tower", "projectiles/ice_shard"},
+        {"lightning_tower", "projectiles/lightning"}, {"poison_tower", "projectiles/poison_dart"},
+        {"ballista", "projectiles/ballista_bolt"}, {"arcane_tower", "projectiles/arcane_orb"}};
+
+    // Every type in flight at once: each bucket runs its own kernel, and
+    // the non-spinning, trail-less ones skip those lanes
+    for (size_t live : {4096u, 65536u}) {
+        ProjectileSystem mixed(live);
+        mixed.initialize(nullptr, nullptr);
+        std::vector<int> kinds;
+        for (const auto& tower : towers) {
+            kinds.push_back(mixed.registerArchetype(tower.first, tower.second, 400.0f));
+        }
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+        for (size_t i = 0; i < live; ++i) {
+            float a = angle(rng);
+            mixed.fire(kinds[i % kinds.size()], sf::Vector2f(640.0f, 480.0f), sf::Vector2f(std::cos(a), std::sin(a)), 1);
+        }
+        harness.run("ProjectileSystem::update", "mixed types live=" + std::to_string(live), live, [&]() {
+            mixed.update(0.0001f);
+        });
+    }
+
+    // A volley from every tower type in towers.json: resolving the texture
+    // name per shot against firing a registered archetype
+    const size_t volley = 4096;
+    ProjectileSystem projectiles(volley);
+    projectiles.initialize(nullptr, nullptr);
+    std::vector<int> archetypes;
+    for (const auto& tower : towers) {
+        archetypes.push_back(projectiles.registerArchetype(tower.first, tower.second, 400.0f));
+    }
+    harness.run("ProjectileSystem::spawn", "by name shots=" + std::to_string(volley), volley, [&]() {
+        projectiles.clear();
+    }, [&]() {
+        for (size_t i = 0; i < volley; ++i) {
+            ProjectileInfo info;
+            info.direction = sf::Vector2f(1.0f, 0.0f);
+            info.speed = 400.0f;
+            info.atlas = towers[i % towers.size()].second;
+            info.source = towers[i % towers.size()].first;
+            projectiles.spawn(info, sf::Vector2f(640.0f, 480.0f));
+        }
+    });
+    harness.run("ProjectileSystem::fire", "archetype shots=" + std::to_string(volley), volley, [&]() {
+        projectiles.clear();
+    }, [&]() {
+        for (size_t i = 0; i < volley; ++i) {
+            projectiles.fire(archetypes[i % archetypes.size()], sf::Vector2f(640.0f, 480.0f), sf::Vector2f(1.0f, 0.0f), 1);
+        }
+    });
+    harness.addCounter("archetypes", static_cast<double>(projectiles.getArchetypeCount()));
+
+    // A burst into a pool that starts at one page: growth cost against a
+    // pool sized up front
+    const size_t burst = 65536;
+    for (size_t pageSize : {256u, 4096u, 65536u}) {
+        std::unique_ptr<ProjectileSystem> growing;
+        int arrow = 0;
+        harness.run("ProjectileSystem::fire", "burst=" + std::to_string(burst) + " page=" + std::to_string(pageSize),
+                    burst, [&]() {
+            growing = std::make_unique<ProjectileSystem>(pageSize);
+            arrow = growing->registerArchetype("arrow_tower", "projectiles/arrow", 400.0f);
+        }, [&]() {
+            for (size_t i = 0; i < burst; ++i) {
+                growing->fire(arrow, sf::Vector2f(640.0f, 480.0f), sf::Vector2f(1.0f, 0.0f), 1);
+            }
+        }, 20);
+        // Null when --filter skipped the run
+        if (growing) harness.addCounter("pages", static_cast<double>(growing->getPoolStats().pages));
+    }
+}
+
+void benchParticles(bench::Harness& harness) {
+    for (size_t capacity : {1000u, 10000u, 100000u}) {
+        std::string params = "max=" + std::to_string(capacity);
+        ParticleSystem particles(capacity);
+        const int burst = 1000;
+
+        // emit() into a half-full system, as during a busy wave
+        harness.run("ParticleSystem::emit", params, burst, [&]() {
+            particles.clear();
+            particles.emit(sf::Vector2f(0.0f, 0.0f), Particle::SPARKLE, static_cast<int>(capacity / 2));
+        }, [&]() {
+            particles.emit(sf::Vector2f(100.0f, 100.0f), Particle::FIRE, burst);
+        }, capacity >= 100000 ? 5 : 0);
+
+        particles.clear();
+        particles.emit(sf::Vector2f(0.0f, 0.0f), Particle::SMOKE, static_cast<int>(capacity));
+        harness.run("ParticleSystem::update", params, capacity, [&]() {
+            particles.update(0.0001f);
+        });
+    }
+}
+
+void benchEnemyQueries(bench::Harness& harness) {
+    const int queries = 1024;
+    for (int count : {100, 1000, 10000}) {
+        EnemySystem enemies;
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> x(0.0f, 1280.0f);
+        std::uniform_real_distribution<float> y(0.0f, 960.0f);
+        QuietLog quiet;
+        for (int i = 0; i < count; ++i) {
+            auto enemy = std::make_shared<Enemy>();
+            enemy->initialize();
+            enemy->transform->position = sf::Vector2f(x(rng), y(rng));
+            enemies.add(enemy);
+        }
+        enemies.update(0.0f);
+        quiet.restore();
+
+        std::vector<sf::Vector2f> probes(queries);
+        for (auto& probe : probes) probe = sf::Vector2f(x(rng), y(rng));
+        harness.run("EnemySystem::getEnemiesInRange", "enemies=" + std::to_string(count), queries, [&]() {
+            size_t found = 0;
+            for (const auto& probe : probes) found += enemies.getEnemiesInRange(probe, 150.0f).size();
+            bench::doNotOptimize(found);
+        });
+    }
+}
+
+// Handing a spawned enemy its route: copying the waypoints into every
+// follower, as spawning used to, against sharing one interned route. Then
+// position-at-distance queries on that route.
+void benchPathRoutes(bench::Harness& harness) {
+    const int followers = 10000;
+    for (int waypoints : {16, 256}) {
+        std::vector<sf::Vector2f> points(waypoints);
+        for (int i = 0; i < waypoints; ++i) points[i] = sf::Vector2f(i * 32.0f, (i % 2) * 64.0f);
+        std::string params = "waypoints=" + std::to_string(waypoints);
+
+        std::vector<std::vector<sf::Vector2f>> copies(followers);
+        harness.run("route per follower (copy)", params, followers, [&]() {
+            copies.assign(followers, {});
+        }, [&]() {
+            for (auto& copy : copies) copy = points;
+        });
+        harness.addCounter("bytes", static_cast<double>(followers) * waypoints * sizeof(sf::Vector2f));
+
+        PathRegistry registry;
+        PathRoute::Ref shared = registry.intern(points);
+        std::vector<PathFollower> sharing(followers);
+        harness.run("route per follower (shared)", params, followers, [&]() {
+            for (auto& follower : sharing) follower.route.reset();
+        }, [&]() {
+            for (auto& follower : sharing) follower.setRoute(shared);
+        });
+        harness.addCounter("bytes", static_cast<double>(registry.getMemoryBytes()));
+
+        // Position at a distance: walking the vector against the route's table
+        PathfindingSystem pathfinding;
+        const int queries = 1000;
+        std::vector<float> progress(queries);
+        for (int i = 0; i < queries; ++i) progress[i] = (i * 7919 % queries) / float(queries);
+        harness.run("position at distance (walk)", params, queries, [&]() {
+            for (float p : progress) bench::doNotOptimize(pathfinding.getInterpolatedPosition(points, p));
+        });
+        harness.run("position at distance (table)", params, queries, [&]() {
+            for (float p : progress) bench::doNotOptimize(pathfinding.getInterpolatedPosition(*shared, p));
+        });
+        // A walker moving a few pixels a tick
+        harness.run("position at distance (cursor)", params, queries, [&]() {
+            PathRoute::Cursor cursor;
+            float step = shared->totalLength() / queries;
+            for (int i = 0; i < queries; ++i) bench::doNotOptimize(shared->positionAt(i * step, cursor));
+        });
+    }
+}
+
+void benchEventBus(bench::Harness& harness) {
+    const int publishes = 10000;
+    for (int subscribers : {1, 8, 64}) {
+        EventBus bus;
+        long long received = 0;
+        for (int i = 0; i < subscribers; ++i) {
+            bus.subscribe("enemy_died", [&received](const std::string&, void* data) {
+                received += *static_cast<int*>(data);
+            });
+        }
+        int payload = 1;
+        harness.run("EventBus::publish", "subscribers=" + std::to_string(subscribers), publishes, [&]() {
+            for (int i = 0; i < publishes; ++i) bus.publish("enemy_died", &payload);
+        });
+        bench::doNotOptimize(received);
+    }
+}
+
+void benchDataLoading(bench::Harness& harness) {
+    harness.run("JSONLoader::loadAllGameData", "data/", 1, [&]() {
+        JSONLoader loader;
+        bool loaded = loader.loadAllGameData();
+        bench::doNotOptimize(loaded);
+    });
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::string jsonPath = "bench_results.json";
+    bench::Harness harness(3, 15);
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--json" && i + 1 < argc) jsonPath = argv[++i];
+        else if (arg == "--filter" && i + 1 < argc) harness.setFilter(argv[++i]);
+        else if (arg == "--reps" && i + 1 < argc) harness.setRepetitions(std::atoi(argv[++i]));
+    }
+
+    if (checkHierarchicalReachability() > 0) return 1;
+    harness.printHeader();
+    benchPathfinding(harness);
+    benchGrid(harness);
+    benchSearchModes(harness);
+    benchHierarchical(harness);
+    benchFlowFieldRepair(harness);
+    benchProjectiles(harness);
+    benchParticles(harness);
+    benchEnemyQueries(harness);
+    benchPathRoutes(harness);
+    benchEventBus(harness);
+    benchDataLoading(harness);
+
+    std::ofstream out(jsonPath);
+    harness.writeJson(out);
+    std::cout << "Wrote " << harness.results().size() << " results to " << jsonPath << std::endl;
+    return 0;
+}
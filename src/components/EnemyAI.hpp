@@ -1,11 +1,11 @@
 #pragma once
-#include <memory>
-// Forward declaration ONLY
-class Enemy;
+#include <string>
+#include "../core/EntityHandle.hpp"
 struct EnemyAI {
     float pathSpeed = 50.f;
     float attackRange = 0.f;
     float cooldown = 0.f;
     float attackCooldown = 1.0f;
-    std::shared_ptr<Enemy> currentTarget = nullptr;
+    EntityHandle currentTarget;
+    std::string lastHitBy;  // source of the most recent damage; reported on death
 };
\ No newline at end of file
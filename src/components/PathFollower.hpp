@@ -1,15 +1,46 @@
 #pragma once
 #include <vector>
+#include <algorithm>
+#include <cmath>
 #include <SFML/System/Vector2.hpp>
+#include "../systems/PathRegistry.hpp"
+// A cursor on a shared route; the waypoints live in the PathRegistry
 struct PathFollower {
-    std::vector<sf::Vector2f> path;
+    PathRoute::Ref route;
     int currentIndex = 0;
     float speed = 50.0f;
     float arrivalThreshold = 5.0f;
     bool loop = false;
     bool finished = false;
-    bool hasPath() const { return !path.empty() && currentIndex < path.size(); }
-    sf::Vector2f getCurrentTarget() const { 
-        return hasPath() ? path[currentIndex] : sf::Vector2f(0, 0); 
+    float lengthToCurrent = 0.0f;  // arc length from the route's start to its waypoint currentIndex
+    float progress = 0.0f;         // distance along the path, refreshed by EnemySystem each tick
+    bool followField = false;      // steer by EnemySystem's flow field; route is just {spawn, goal}
+    bool hasPath() const { return route && currentIndex < static_cast<int>(route->size()); }
+    sf::Vector2f getCurrentTarget() const {
+        return hasPath() ? route->points[currentIndex] : sf::Vector2f(0, 0);
     }
-};
\ No newline at end of file
+    sf::Vector2f getStart() const {
+        return route && route->size() > 0 ? route->points[0] : sf::Vector2f(0, 0);
+    }
+    void setRoute(PathRoute::Ref newRoute) {
+        route = std::move(newRoute);
+        reset();
+    }
+    void reset() {
+        currentIndex = 0;
+        finished = false;
+        lengthToCurrent = 0.0f;
+        progress = 0.0f;
+    }
+    // Move on to the next waypoint, keeping lengthToCurrent in step
+    void advance() {
+        currentIndex++;
+        if (hasPath()) lengthToCurrent = route->lengths[currentIndex];
+    }
+    float progressAt(const sf::Vector2f& position) const {
+        if (!hasPath()) return lengthToCurrent;
+        sf::Vector2f toTarget = route->points[currentIndex] - position;
+        float remaining = std::sqrt(toTarget.x * toTarget.x + toTarget.y * toTarget.y);
+        return std::max(0.0f, lengthToCurrent - remaining);
+    }
+};
@@ -0,0 +1,37 @@
+#pragma once
+#include <string>
+// Everything about a shot that depends only on who fires it, resolved once
+// when a tower or unit type is first added. Towers and units keep the row's
+// index, so firing copies a row instead of reading texture names. Which of
+// these numbers a type uses (splash, pierce, trail...) is fixed by its
+// ProjectileTraits, not by flags here.
+struct ProjectileArchetype {
+    enum Type {
+        ARROW,
+        FIREBALL,
+        ICE_SHARD,
+        POISON_DART,
+        LIGHTNING,
+        CANNONBALL,
+        BALLISTA_BOLT,
+        ARCANE_ORB
+    };
+    static constexpr int TypeCount = ARCANE_ORB + 1;
+    Type type = ARROW;
+    float speed = 200.f;
+    float maxDistance = 1000.f;
+    float trailInterval = 0.05f;
+    float rotationSpeed = 0.f;
+    float explosionRadius = 0.f;
+    int maxPierce = 1;
+    int statusEffectType = 0; // 0=slow, 1=burn, 2=stun, 3=poison
+    float statusDuration = 0.f;
+    int texture = -1;  // name handles in ProjectileSystem, see getName()
+    int source = -1;   // tower/unit type, for kill attribution
+};
+// A projectile as towers.json/units.json describe it; speed 0 leaves the
+// firer's default
+struct ProjectileSpec {
+    std::string texture;
+    float speed = 0.f;
+};
@@ -7,6 +7,7 @@ struct ProjectileInfo {
     int damage = 1;
     bool active = false;
     std::string atlas;
+    std::string source;  // tower/unit type that fired it
     // PHASE 3: Enhanced projectile properties
     sf::Vector2f startPos;
     float distanceTraveled = 0.f;
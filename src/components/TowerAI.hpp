@@ -1,8 +1,27 @@
 #pragma once
-#include <memory>
-// Forward declaration ONLY
-class Enemy;
+#include <string>
+#include "../core/EntityHandle.hpp"
 struct TowerAI {
+    // Which enemy in range a tower shoots; set per tower type from towers.json "targeting"
+    enum Targeting {
+        FIRST,      // furthest along the path
+        LAST,       // least far along the path
+        STRONGEST,  // most hp left
+        WEAKEST,    // least hp left
+        CLOSEST
+    };
     float cooldown = 0.f;
-    std::shared_ptr<Enemy> currentTarget = nullptr;
-};
\ No newline at end of file
+    EntityHandle currentTarget;  // enemy handle, resolved through EnemySystem::find
+    Targeting targeting = FIRST;
+    std::string source;  // tower type, stamped on projectiles so kills can be attributed
+    int projectile = -1; // archetype row in ProjectileSystem, set by TowerSystem::add
+    static bool parseTargeting(const std::string& name, Targeting& out) {
+        if (name == "first") out = FIRST;
+        else if (name == "last") out = LAST;
+        else if (name == "strongest") out = STRONGEST;
+        else if (name == "weakest") out = WEAKEST;
+        else if (name == "closest") out = CLOSEST;
+        else return false;
+        return true;
+    }
+};
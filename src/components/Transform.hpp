@@ -3,10 +3,11 @@
 #include <cmath>
 struct Transform {
     sf::Vector2f position;
+    sf::Vector2f previousPosition;  // position before the last simulation tick, for interpolation
     sf::Vector2f scale;
     float rotation;  // PHASE 3: Add rotation
     Transform(sf::Vector2f pos = {0, 0}) 
-        : position(pos), scale({1, 1}), rotation(0) {}
+        : position(pos), previousPosition(pos), scale({1, 1}), rotation(0) {}
     // PHASE 3: Rotation helper methods
     void lookAt(const sf::Vector2f& target) {
         sf::Vector2f direction = target - position;
@@ -1,10 +1,13 @@
 #pragma once
-#include <memory>
-// Forward declaration ONLY
-class Enemy;
+#include <SFML/System/Vector2.hpp>
+#include <string>
+#include "../core/EntityHandle.hpp"
 struct UnitAI {
     float cooldown = 0.f;
     bool melee = false;
     float attackRange = 100.f;
-    std::shared_ptr<Enemy> currentTarget = nullptr;
+    EntityHandle currentTarget;  // enemy handle, resolved through EnemySystem::find
+    sf::Vector2f targetPosition; // refreshed by UnitSystem each tick for movement
+    std::string source;          // unit type, for kill attribution
+    int projectile = -1;         // archetype row in ProjectileSystem, set by UnitSystem::add
 };
\ No newline at end of file
@@ -19,6 +19,7 @@ bool Application::initialize() {
         return false;
     }
     
+    game_->setTickRate(tickRate_);
     std::cout << "[Application] Game created, initializing..." << std::endl;
     if (!game_->initialize()) {
         std::cerr << "[Application] WARNING: Game initialization had issues\n";
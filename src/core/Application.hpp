@@ -11,9 +11,11 @@ public:
     ~Application();
     bool initialize();
     int run();
+    void setTickRate(float tickRate) { tickRate_ = tickRate; }
 private:
     std::unique_ptr<Game> game_;
     std::string title_;
     int width_ = 1280;
     int height_ = 720;
+    float tickRate_ = 60.0f;
 };
\ No newline at end of file
@@ -0,0 +1,22 @@
+#pragma once
+#include "../core/ComponentStore.hpp"
+// Forward declarations ONLY
+struct Transform;
+class SpriteComp;
+struct AnimationStateComp;
+struct HealthComp;
+struct StatsComp;
+struct PathFollower;
+struct ColliderComp;
+struct StatusEffectsComp;
+struct EnemyAI;
+struct UnitAI;
+struct TowerAI;
+struct SelectableComp;
+struct UpgradeComp;
+// One store per entity kind, matching the component members of each entity class
+using EnemyStore = ComponentStore<Transform, SpriteComp, AnimationStateComp, HealthComp, StatsComp,
+                                  PathFollower, ColliderComp, StatusEffectsComp, EnemyAI>;
+using UnitStore = ComponentStore<Transform, SpriteComp, AnimationStateComp, HealthComp, StatsComp,
+                                 ColliderComp, UnitAI, SelectableComp, UpgradeComp>;
+using TowerStore = ComponentStore<Transform, SpriteComp, AnimationStateComp, TowerAI, UpgradeComp, StatsComp>;
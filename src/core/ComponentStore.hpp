@@ -0,0 +1,146 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+// Archetype storage: each component type gets its own contiguous array inside
+// fixed-size chunks, so a system that touches two components streams through
+// two arrays instead of chasing a heap pointer per entity.
+//
+// acquire() hands out a Lease for one slot. bind<T>() returns a shared_ptr that
+// aliases the lease, which is how the entity classes keep their
+// `enemy->transform->position` style members. The slot is released (and its
+// components reset) once the last lease or bound pointer goes away. Chunks
+// never move, so bound pointers stay valid for as long as they are held.
+//
+// A slot is only visited by view<...>() while it is active; systems flip that
+// when they take an entity in or drop it, so an entity that is still
+// referenced elsewhere no longer takes part in the simulation.
+template<typename... Components>
+class ComponentStore {
+public:
+    static constexpr size_t kChunkSize = 256;
+
+    struct Storage;
+    struct Slot {
+        std::shared_ptr<Storage> storage;
+        uint32_t chunk;
+        uint32_t index;
+        Slot(std::shared_ptr<Storage> s, uint32_t c, uint32_t i)
+            : storage(std::move(s)), chunk(c), index(i) {}
+        ~Slot() { storage->release(chunk, index); }
+    };
+    using Lease = std::shared_ptr<Slot>;
+
+    struct Chunk {
+        std::tuple<std::array<Components, kChunkSize>...> columns;
+        std::array<bool, kChunkSize> active{};
+        uint32_t used = 0;        // slots [0, used) have been handed out at least once
+        uint32_t activeCount = 0;
+        template<typename T>
+        std::array<T, kChunkSize>& column() { return std::get<std::array<T, kChunkSize>>(columns); }
+    };
+
+    struct Storage {
+        std::vector<std::unique_ptr<Chunk>> chunks;
+        std::vector<std::pair<uint32_t, uint32_t>> freeSlots;
+        size_t leased = 0;
+        size_t active = 0;
+        void release(uint32_t chunk, uint32_t index) {
+            Chunk& c = *chunks[chunk];
+            if (c.active[index]) {
+                c.active[index] = false;
+                c.activeCount--;
+                active--;
+            }
+            // Drop component state (strings, effect lists) now rather than on reuse
+            ((c.template column<Components>()[index] = Components()), ...);
+            freeSlots.emplace_back(chunk, index);
+            leased--;
+        }
+    };
+
+    template<typename... Ts>
+    class View {
+    public:
+        explicit View(Storage& storage) : storage_(storage) {}
+        // fn(Ts&...) for every active slot, in chunk order
+        template<typename Fn>
+        void each(Fn&& fn) {
+            for (auto& chunk : storage_.chunks) {
+                if (chunk->activeCount == 0) continue;
+                auto columns = std::forward_as_tuple(chunk->template column<Ts>()...);
+                for (uint32_t i = 0; i < chunk->used; ++i) {
+                    if (!chunk->active[i]) continue;
+                    fn(std::get<std::array<Ts, kChunkSize>&>(columns)[i]...);
+                }
+            }
+        }
+    private:
+        Storage& storage_;
+    };
+
+    ComponentStore() : storage_(std::make_shared<Storage>()) {}
+    ComponentStore(const ComponentStore&) = delete;
+    ComponentStore& operator=(const ComponentStore&) = delete;
+
+    Lease acquire() {
+        Storage& s = *storage_;
+        uint32_t chunk, index;
+        if (!s.freeSlots.empty()) {
+            chunk = s.freeSlots.back().first;
+            index = s.freeSlots.back().second;
+            s.freeSlots.pop_back();
+        } else {
+            if (s.chunks.empty() || s.chunks.back()->used == kChunkSize) {
+                s.chunks.push_back(std::make_unique<Chunk>());
+            }
+            chunk = static_cast<uint32_t>(s.chunks.size() - 1);
+            index = s.chunks.back()->used++;
+        }
+        s.leased++;
+        return std::make_shared<Slot>(storage_, chunk, index);
+    }
+
+    template<typename T>
+    std::shared_ptr<T> bind(const Lease& lease) {
+        return std::shared_ptr<T>(lease, &lease->storage->chunks[lease->chunk]->template column<T>()[lease->index]);
+    }
+
+    // Moves an existing heap component into the slot and repoints the handle at it
+    template<typename T>
+    void adopt(const Lease& lease, std::shared_ptr<T>& component) {
+        std::shared_ptr<T> bound = bind<T>(lease);
+        if (component) *bound = std::move(*component);
+        component = std::move(bound);
+    }
+
+    bool owns(const Lease& lease) const { return lease && lease->storage == storage_; }
+
+    void setActive(const Lease& lease, bool active) {
+        if (!owns(lease)) return;
+        Chunk& c = *storage_->chunks[lease->chunk];
+        if (c.active[lease->index] == active) return;
+        c.active[lease->index] = active;
+        if (active) {
+            c.activeCount++;
+            storage_->active++;
+        } else {
+            c.activeCount--;
+            storage_->active--;
+        }
+    }
+
+    template<typename... Ts>
+    View<Ts...> view() { return View<Ts...>(*storage_); }
+
+    size_t activeCount() const { return storage_->active; }
+    size_t leasedCount() const { return storage_->leased; }
+    size_t chunkCount() const { return storage_->chunks.size(); }
+
+private:
+    std::shared_ptr<Storage> storage_;
+};
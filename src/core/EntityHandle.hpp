@@ -0,0 +1,17 @@
+#pragma once
+#include <cstdint>
+// 64-bit generational reference to an entity owned by one of the systems.
+// index picks the slot, generation must match the slot's current generation;
+// once the entity is removed the slot's generation moves on and every old
+// handle to it stops resolving. Generation 0 is never issued, so a
+// default-constructed handle is the null handle.
+struct EntityHandle {
+    uint32_t index = 0;
+    uint32_t generation = 0;
+    bool isNull() const { return generation == 0; }
+    explicit operator bool() const { return generation != 0; }
+    bool operator==(const EntityHandle& other) const {
+        return index == other.index && generation == other.generation;
+    }
+    bool operator!=(const EntityHandle& other) const { return !(*this == other); }
+};
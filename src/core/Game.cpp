@@ -1,19 +1,17 @@
 #include "../core/Game.hpp"
-#include "../systems/PathfindingSystem.hpp"
+#include "../core/Simulation.hpp"
 #include "../systems/ProjectileSystem.hpp"
 #include "../systems/EnemySystem.hpp"
 #include "../systems/TowerSystem.hpp"
 #include "../systems/UnitSystem.hpp"
 #include "../systems/RenderSystem.hpp"
 #include "../systems/AnimationSystem.hpp"
-#include "../systems/CollisionSystem.hpp"
 #include "../systems/ParticleSystem.hpp"
 #include "../systems/WaveSystem.hpp"
 #include "../systems/UIManager.hpp"
 #include "../systems/AnimationAtlasLoader.hpp"
 #include "../systems/UpgradeSystem.hpp"
 #include "../systems/GameStateManager.hpp"
-#include "../systems/SaveLoadSystem.hpp"
 #include "../systems/CameraSystem.hpp"
 #include "../systems/InputHandlerSystem.hpp"
 #include "../core/EventBus.hpp"
@@ -26,20 +24,16 @@
 #include "../components/Health.hpp"
 #include "../components/Stats.hpp"
 #include "../maps/Map.hpp"
-#include "../json/JSONLoader.hpp"
 #include <iostream>
 #include <cstdlib>
 #include <ctime>
 #include <cmath>
 
-Game::Game() : running_(true), gold_(500), lives_(20), currentWave_(0), 
-               nextWaveTimer_(0.0f), waveInProgress_(false), 
+Game::Game() : running_(true),
                placingTower_(false), placingUnit_(false),
                screenShakeTimer_(0.0f), screenShakeIntensity_(0.0f),
                animationSystemEnabled_(false), debugMode_(true),
-               selectedTower_(nullptr), showTowerInfo_(false), 
-               selectedUnit_(nullptr), showUnitInfo_(false),
-               mainBaseTower_(nullptr) {
+               showTowerInfo_(false), showUnitInfo_(false) {
     std::cout << "[Game] Constructor - Creating window..." << std::endl;
     window_.create(sf::VideoMode(640, 480), "Tower Defense");
     window_.setFramerateLimit(60);
@@ -59,24 +53,25 @@ bool Game::initialize() {
         // Phase 1: Create core systems
         std::cout << "\n[Game] PHASE 1: Creating Core Systems..." << std::endl;
         
-        pathfindingSystem_ = std::make_unique<PathfindingSystem>();
-        projectileSystem_ = std::make_unique<ProjectileSystem>();
-        enemySystem_ = std::make_unique<EnemySystem>();
-        towerSystem_ = std::make_unique<TowerSystem>();
-        unitSystem_ = std::make_unique<UnitSystem>();
+        simulation_ = std::make_unique<Simulation>();
         renderSystem_ = std::make_unique<RenderSystem>(window_);
         animationSystem_ = std::make_unique<AnimationSystem>();
-        collisionSystem_ = std::make_unique<CollisionSystem>();
         particleSystem_ = std::make_unique<ParticleSystem>();
-        waveSystem_ = std::make_unique<WaveSystem>();
         uiManager_ = std::make_unique<UIManager>();
-        eventBus_ = std::make_unique<EventBus>();
         resourceManager_ = std::make_unique<ResourceManager>();
-        map_ = std::make_unique<Map>();
         gameStateManager_ = std::make_unique<GameStateManager>();
         cameraSystem_ = std::make_unique<CameraSystem>(window_);
         inputHandler_ = std::make_unique<InputHandler>(window_);
-        enemySystem_->setEventBus(eventBus_.get()); 
+        
+        // Gameplay systems live in the simulation; keep short-hands for rendering
+        projectileSystem_ = simulation_->getProjectileSystem();
+        enemySystem_ = simulation_->getEnemySystem();
+        towerSystem_ = simulation_->getTowerSystem();
+        unitSystem_ = simulation_->getUnitSystem();
+        waveSystem_ = simulation_->getWaveSystem();
+        eventBus_ = simulation_->getEventBus();
+        map_ = simulation_->getMap();
+        simulation_->setParticleSystem(particleSystem_.get());
         std::cout << "[Game] ✓✓✓ All Core Systems Created!" << std::endl;
 
         // Phase 2: Load assets
@@ -85,10 +80,9 @@ bool Game::initialize() {
             std::cerr << "[Game] ⚠ WARNING: Some assets failed to load" << std::endl;
         }
         
-        // Phase 3: Load game data
+        // Phase 3: Load game data, map and initial state
         std::cout << "\n[Game] PHASE 3: Loading Game Data..." << std::endl;
-        JSONLoader jsonLoader;
-        if (!jsonLoader.loadAllGameData()) {
+        if (!simulation_->initialize("forest_path")) {
             std::cerr << "[Game] ⚠ WARNING: Some game data failed to load" << std::endl;
         }
 
@@ -96,24 +90,8 @@ bool Game::initialize() {
         std::cout << "\n[Game] PHASE 4: Initializing Systems..." << std::endl;
         
         uiManager_->initialize(resourceManager_.get());
-        enemySystem_->initialize(projectileSystem_.get(), unitSystem_.get());
-        towerSystem_->initialize(enemySystem_.get(), projectileSystem_.get());
-        unitSystem_->initialize(enemySystem_.get(), projectileSystem_.get());
-        projectileSystem_->initialize(enemySystem_.get(), particleSystem_.get());
-        pathfindingSystem_->initialize(20, 15, 32.0f);
-        waveSystem_->load(jsonLoader.getAllWaves());
         AnimationAtlasLoader::loadAllAtlases(animationSystem_.get());
         
-        waveSystem_->setSpawnCallback([this](const std::string& enemyId) {
-            this->spawnEnemy(enemyId);
-        });
-        
-        // Load map
-        if (!map_->loadFromJSON(&jsonLoader, "forest_path")) {
-            std::cerr << "[Game] Map load failed, using default" << std::endl;
-            map_->loadDefault();
-        }
-        
         // Setup camera with correct map bounds
         float mapWidth = map_->cols() * map_->tileSize();
         float mapHeight = map_->rows() * map_->tileSize();
@@ -134,17 +112,11 @@ bool Game::initialize() {
         setupGameCallbacks();
         setupUICallbacks();
 
-        // Phase 6: Create initial game state
+        // Phase 6: Present initial game state
         std::cout << "\n[Game] PHASE 6: Creating Initial State..." << std::endl;
-        createInitialTowers();
-        
         originalView_ = window_.getDefaultView();
         setupEntityAnimations();
         setupEntityTextures();
-        
-        currentWave_ = 0;
-        nextWaveTimer_ = 0.0f;
-        waveInProgress_ = false;
 
         std::cout << "\n[Game] ========================================" << std::endl;
         std::cout << "[Game] ✓✓✓ INITIALIZATION COMPLETE ✓✓✓" << std::endl;
@@ -205,8 +177,8 @@ void Game::setupUICallbacks() {
     
     // Start wave from UI
     uiManager_->setStartWaveCallback([this]() {
-        if (!waveInProgress_ && nextWaveTimer_ <= 0.0f && currentWave_ < waveSystem_->getTotalWaves()) {
-            std::cout << "[Game] Starting wave from UI: " << (currentWave_ + 1) << std::endl;
+        if (simulation_->canStartNextWave()) {
+            std::cout << "[Game] Starting wave from UI: " << (simulation_->getCurrentWave() + 1) << std::endl;
             startNextWave();
         }
     });
@@ -259,9 +231,9 @@ void Game::setupInputBindings() {
     inputHandler_->onKeyPress(sf::Keyboard::Num1, [this]() {
         if (gameStateManager_->isPlaying()) {
             // Clear any existing selections FIRST
-            selectedTower_ = nullptr;
+            selectedTower_ = EntityHandle();
             showTowerInfo_ = false;
-            selectedUnit_ = nullptr;
+            selectedUnit_ = EntityHandle();
             showUnitInfo_ = false;
             
             // Now set placement mode
@@ -277,9 +249,9 @@ void Game::setupInputBindings() {
     
     inputHandler_->onKeyPress(sf::Keyboard::Num2, [this]() {
         if (gameStateManager_->isPlaying()) {
-            selectedTower_ = nullptr;
+            selectedTower_ = EntityHandle();
             showTowerInfo_ = false;
-            selectedUnit_ = nullptr;
+            selectedUnit_ = EntityHandle();
             showUnitInfo_ = false;
             
             placingTower_ = true;
@@ -292,9 +264,9 @@ void Game::setupInputBindings() {
     
     inputHandler_->onKeyPress(sf::Keyboard::Num3, [this]() {
         if (gameStateManager_->isPlaying()) {
-            selectedTower_ = nullptr;
+            selectedTower_ = EntityHandle();
             showTowerInfo_ = false;
-            selectedUnit_ = nullptr;
+            selectedUnit_ = EntityHandle();
             showUnitInfo_ = false;
             
             placingTower_ = true;
@@ -307,9 +279,9 @@ void Game::setupInputBindings() {
     
     inputHandler_->onKeyPress(sf::Keyboard::Num4, [this]() {
         if (gameStateManager_->isPlaying()) {
-            selectedTower_ = nullptr;
+            selectedTower_ = EntityHandle();
             showTowerInfo_ = false;
-            selectedUnit_ = nullptr;
+            selectedUnit_ = EntityHandle();
             showUnitInfo_ = false;
             
             placingTower_ = true;
@@ -322,9 +294,9 @@ void Game::setupInputBindings() {
     
     inputHandler_->onKeyPress(sf::Keyboard::Num5, [this]() {
         if (gameStateManager_->isPlaying()) {
-            selectedTower_ = nullptr;
+            selectedTower_ = EntityHandle();
             showTowerInfo_ = false;
-            selectedUnit_ = nullptr;
+            selectedUnit_ = EntityHandle();
             showUnitInfo_ = false;
             
             placingTower_ = true;
@@ -337,9 +309,9 @@ void Game::setupInputBindings() {
     
     inputHandler_->onKeyPress(sf::Keyboard::Num6, [this]() {
         if (gameStateManager_->isPlaying()) {
-            selectedTower_ = nullptr;
+            selectedTower_ = EntityHandle();
             showTowerInfo_ = false;
-            selectedUnit_ = nullptr;
+            selectedUnit_ = EntityHandle();
             showUnitInfo_ = false;
             
             placingTower_ = true;
@@ -352,9 +324,9 @@ void Game::setupInputBindings() {
     
     inputHandler_->onKeyPress(sf::Keyboard::Num7, [this]() {
         if (gameStateManager_->isPlaying()) {
-            selectedTower_ = nullptr;
+            selectedTower_ = EntityHandle();
             showTowerInfo_ = false;
-            selectedUnit_ = nullptr;
+            selectedUnit_ = EntityHandle();
             showUnitInfo_ = false;
             
             placingTower_ = true;
@@ -367,9 +339,9 @@ void Game::setupInputBindings() {
     
     inputHandler_->onKeyPress(sf::Keyboard::Num8, [this]() {
         if (gameStateManager_->isPlaying()) {
-            selectedTower_ = nullptr;
+            selectedTower_ = EntityHandle();
             showTowerInfo_ = false;
-            selectedUnit_ = nullptr;
+            selectedUnit_ = EntityHandle();
             showUnitInfo_ = false;
             
             placingTower_ = true;
@@ -382,9 +354,9 @@ void Game::setupInputBindings() {
     
     inputHandler_->onKeyPress(sf::Keyboard::Num9, [this]() {
         if (gameStateManager_->isPlaying()) {
-            selectedTower_ = nullptr;
+            selectedTower_ = EntityHandle();
             showTowerInfo_ = false;
-            selectedUnit_ = nullptr;
+            selectedUnit_ = EntityHandle();
             showUnitInfo_ = false;
             
             placingTower_ = true;
@@ -397,9 +369,9 @@ void Game::setupInputBindings() {
     
     inputHandler_->onKeyPress(sf::Keyboard::Num0, [this]() {
         if (gameStateManager_->isPlaying()) {
-            selectedTower_ = nullptr;
+            selectedTower_ = EntityHandle();
             showTowerInfo_ = false;
-            selectedUnit_ = nullptr;
+            selectedUnit_ = EntityHandle();
             showUnitInfo_ = false;
             
             placingTower_ = true;
@@ -412,9 +384,9 @@ void Game::setupInputBindings() {
     
     inputHandler_->onKeyPress(sf::Keyboard::Dash, [this]() {
         if (gameStateManager_->isPlaying()) {
-            selectedTower_ = nullptr;
+            selectedTower_ = EntityHandle();
             showTowerInfo_ = false;
-            selectedUnit_ = nullptr;
+            selectedUnit_ = EntityHandle();
             showUnitInfo_ = false;
             
             placingTower_ = true;
@@ -427,9 +399,9 @@ void Game::setupInputBindings() {
     
     inputHandler_->onKeyPress(sf::Keyboard::Equal, [this]() {
         if (gameStateManager_->isPlaying()) {
-            selectedTower_ = nullptr;
+            selectedTower_ = EntityHandle();
             showTowerInfo_ = false;
-            selectedUnit_ = nullptr;
+            selectedUnit_ = EntityHandle();
             showUnitInfo_ = false;
             
             placingTower_ = true;
@@ -444,9 +416,9 @@ void Game::setupInputBindings() {
     // Quick unit selection (F1-F12)
     inputHandler_->onKeyPress(sf::Keyboard::F1, [this]() {
         if (gameStateManager_->isPlaying()) {
-            selectedTower_ = nullptr;
+            selectedTower_ = EntityHandle();
             showTowerInfo_ = false;
-            selectedUnit_ = nullptr;
+            selectedUnit_ = EntityHandle();
             showUnitInfo_ = false;
             
             placingUnit_ = true;
@@ -459,9 +431,9 @@ void Game::setupInputBindings() {
     
     inputHandler_->onKeyPress(sf::Keyboard::F2, [this]() {
         if (gameStateManager_->isPlaying()) {
-            selectedTower_ = nullptr;
+            selectedTower_ = EntityHandle();
             showTowerInfo_ = false;
-            selectedUnit_ = nullptr;
+            selectedUnit_ = EntityHandle();
             showUnitInfo_ = false;
             
             placingUnit_ = true;
@@ -474,9 +446,9 @@ void Game::setupInputBindings() {
     
     inputHandler_->onKeyPress(sf::Keyboard::F3, [this]() {
         if (gameStateManager_->isPlaying()) {
-            selectedTower_ = nullptr;
+            selectedTower_ = EntityHandle();
             showTowerInfo_ = false;
-            selectedUnit_ = nullptr;
+            selectedUnit_ = EntityHandle();
             showUnitInfo_ = false;
             
             placingUnit_ = true;
@@ -489,9 +461,9 @@ void Game::setupInputBindings() {
     
     inputHandler_->onKeyPress(sf::Keyboard::F4, [this]() {
         if (gameStateManager_->isPlaying()) {
-            selectedTower_ = nullptr;
+            selectedTower_ = EntityHandle();
             showTowerInfo_ = false;
-            selectedUnit_ = nullptr;
+            selectedUnit_ = EntityHandle();
             showUnitInfo_ = false;
             
             placingUnit_ = true;
@@ -504,9 +476,9 @@ void Game::setupInputBindings() {
     
     inputHandler_->onKeyPress(sf::Keyboard::F5, [this]() {
         if (gameStateManager_->isPlaying()) {
-            selectedTower_ = nullptr;
+            selectedTower_ = EntityHandle();
             showTowerInfo_ = false;
-            selectedUnit_ = nullptr;
+            selectedUnit_ = EntityHandle();
             showUnitInfo_ = false;
             
             placingUnit_ = true;
@@ -519,9 +491,9 @@ void Game::setupInputBindings() {
     
     inputHandler_->onKeyPress(sf::Keyboard::F6, [this]() {
         if (gameStateManager_->isPlaying()) {
-            selectedTower_ = nullptr;
+            selectedTower_ = EntityHandle();
             showTowerInfo_ = false;
-            selectedUnit_ = nullptr;
+            selectedUnit_ = EntityHandle();
             showUnitInfo_ = false;
             
             placingUnit_ = true;
@@ -534,9 +506,9 @@ void Game::setupInputBindings() {
     
     inputHandler_->onKeyPress(sf::Keyboard::F7, [this]() {
         if (gameStateManager_->isPlaying()) {
-            selectedTower_ = nullptr;
+            selectedTower_ = EntityHandle();
             showTowerInfo_ = false;
-            selectedUnit_ = nullptr;
+            selectedUnit_ = EntityHandle();
             showUnitInfo_ = false;
             
             placingUnit_ = true;
@@ -549,9 +521,9 @@ void Game::setupInputBindings() {
     
     inputHandler_->onKeyPress(sf::Keyboard::F8, [this]() {
         if (gameStateManager_->isPlaying()) {
-            selectedTower_ = nullptr;
+            selectedTower_ = EntityHandle();
             showTowerInfo_ = false;
-            selectedUnit_ = nullptr;
+            selectedUnit_ = EntityHandle();
             showUnitInfo_ = false;
             
             placingUnit_ = true;
@@ -564,9 +536,9 @@ void Game::setupInputBindings() {
     
     inputHandler_->onKeyPress(sf::Keyboard::F9, [this]() {
         if (gameStateManager_->isPlaying()) {
-            selectedTower_ = nullptr;
+            selectedTower_ = EntityHandle();
             showTowerInfo_ = false;
-            selectedUnit_ = nullptr;
+            selectedUnit_ = EntityHandle();
             showUnitInfo_ = false;
             
             placingUnit_ = true;
@@ -579,9 +551,9 @@ void Game::setupInputBindings() {
     
     inputHandler_->onKeyPress(sf::Keyboard::F10, [this]() {
         if (gameStateManager_->isPlaying()) {
-            selectedTower_ = nullptr;
+            selectedTower_ = EntityHandle();
             showTowerInfo_ = false;
-            selectedUnit_ = nullptr;
+            selectedUnit_ = EntityHandle();
             showUnitInfo_ = false;
             
             placingUnit_ = true;
@@ -594,9 +566,9 @@ void Game::setupInputBindings() {
     
     inputHandler_->onKeyPress(sf::Keyboard::F11, [this]() {
         if (gameStateManager_->isPlaying()) {
-            selectedTower_ = nullptr;
+            selectedTower_ = EntityHandle();
             showTowerInfo_ = false;
-            selectedUnit_ = nullptr;
+            selectedUnit_ = EntityHandle();
             showUnitInfo_ = false;
             
             placingUnit_ = true;
@@ -609,9 +581,9 @@ void Game::setupInputBindings() {
     
     inputHandler_->onKeyPress(sf::Keyboard::F12, [this]() {
         if (gameStateManager_->isPlaying()) {
-            selectedTower_ = nullptr;
+            selectedTower_ = EntityHandle();
             showTowerInfo_ = false;
-            selectedUnit_ = nullptr;
+            selectedUnit_ = EntityHandle();
             showUnitInfo_ = false;
             
             placingUnit_ = true;
@@ -651,8 +623,8 @@ void Game::setupInputBindings() {
     
     // Wave control
     inputHandler_->onKeyPress(sf::Keyboard::Space, [this]() {
-        if (gameStateManager_->isPlaying() && !waveInProgress_ && nextWaveTimer_ <= 0.0f && currentWave_ < waveSystem_->getTotalWaves()) {
-            std::cout << "[Input] Starting wave " << (currentWave_ + 1) << std::endl;
+        if (gameStateManager_->isPlaying() && simulation_->canStartNextWave()) {
+            std::cout << "[Input] Starting wave " << (simulation_->getCurrentWave() + 1) << std::endl;
             startNextWave();
         }
     });
@@ -783,10 +755,10 @@ void Game::render() {
             modeText.setFont(font);
             
             if (placingTower_) {
-                modeText.setString("Placing: " + selectedTowerType_ + " (" + std::to_string(getTowerCost(selectedTowerType_)) + "g)");
+                modeText.setString("Placing: " + selectedTowerType_ + " (" + std::to_string(simulation_->getTowerCost(selectedTowerType_)) + "g)");
                 modeText.setFillColor(sf::Color::Yellow);
             } else {
-                modeText.setString("Placing: " + selectedUnitType_ + " (" + std::to_string(getUnitCost(selectedUnitType_)) + "g)");
+                modeText.setString("Placing: " + selectedUnitType_ + " (" + std::to_string(simulation_->getUnitCost(selectedUnitType_)) + "g)");
                 modeText.setFillColor(sf::Color::Cyan);
             }
             
@@ -827,11 +799,13 @@ void Game::render() {
 
 // Render tower selection circle
 void Game::renderTowerSelection() {
+    const auto& tower = towerSystem_->find(selectedTower_);
+    if (!tower) return;
     // Selection circle
     sf::CircleShape selectionCircle(60.0f);
     selectionCircle.setPosition(
-        selectedTower_->transform->position.x - 60,
-        selectedTower_->transform->position.y - 60
+        tower->transform->position.x - 60,
+        tower->transform->position.y - 60
     );
     selectionCircle.setFillColor(sf::Color::Transparent);
     selectionCircle.setOutlineColor(sf::Color(255, 255, 0, 200));
@@ -839,10 +813,10 @@ void Game::renderTowerSelection() {
     window_.draw(selectionCircle);
     
     // Range circle
-    sf::CircleShape rangeCircle(selectedTower_->stats->attackRange);
+    sf::CircleShape rangeCircle(tower->stats->attackRange);
     rangeCircle.setPosition(
-        selectedTower_->transform->position.x - selectedTower_->stats->attackRange,
-        selectedTower_->transform->position.y - selectedTower_->stats->attackRange
+        tower->transform->position.x - tower->stats->attackRange,
+        tower->transform->position.y - tower->stats->attackRange
     );
     rangeCircle.setFillColor(sf::Color(100, 150, 255, 30));
     rangeCircle.setOutlineColor(sf::Color(100, 150, 255, 100));
@@ -852,11 +826,13 @@ void Game::renderTowerSelection() {
 
 // Render unit selection circle
 void Game::renderUnitSelection() {
+    const auto& unit = unitSystem_->find(selectedUnit_);
+    if (!unit) return;
     // Selection circle
     sf::CircleShape selectionCircle(40.0f);
     selectionCircle.setPosition(
-        selectedUnit_->transform->position.x - 40,
-        selectedUnit_->transform->position.y - 40
+        unit->transform->position.x - 40,
+        unit->transform->position.y - 40
     );
     selectionCircle.setFillColor(sf::Color::Transparent);
     selectionCircle.setOutlineColor(sf::Color(0, 255, 0, 200));
@@ -864,10 +840,10 @@ void Game::renderUnitSelection() {
     window_.draw(selectionCircle);
     
     // Attack range circle
-    sf::CircleShape rangeCircle(selectedUnit_->stats->attackRange);
+    sf::CircleShape rangeCircle(unit->stats->attackRange);
     rangeCircle.setPosition(
-        selectedUnit_->transform->position.x - selectedUnit_->stats->attackRange,
-        selectedUnit_->transform->position.y - selectedUnit_->stats->attackRange
+        unit->transform->position.x - unit->stats->attackRange,
+        unit->transform->position.y - unit->stats->attackRange
     );
     rangeCircle.setFillColor(sf::Color(100, 255, 100, 30));
     rangeCircle.setOutlineColor(sf::Color(100, 255, 100, 100));
@@ -877,7 +853,8 @@ void Game::renderUnitSelection() {
 
 // Render tower info panel
 void Game::renderSelectedTowerInfo() {
-    if (!selectedTower_ || !resourceManager_->hasFont("kenney_mini")) return;
+    const auto& tower = towerSystem_->find(selectedTower_);
+    if (!tower || !resourceManager_->hasFont("kenney_mini")) return;
     
     const sf::Font& font = resourceManager_->getFont("kenney_mini");
     
@@ -892,7 +869,7 @@ void Game::renderSelectedTowerInfo() {
     // Tower name
     sf::Text nameText;
     nameText.setFont(font);
-    nameText.setString(selectedTower_->towerType);
+    nameText.setString(tower->towerType);
     nameText.setCharacterSize(20);
     nameText.setFillColor(sf::Color::Yellow);
     nameText.setPosition(window_.getSize().x - 310, 80);
@@ -911,15 +888,15 @@ void Game::renderSelectedTowerInfo() {
         yPos += 22;
     };
     
-    drawStat("Level", std::to_string(selectedTower_->upgrade->level));
-    drawStat("Damage", std::to_string(static_cast<int>(selectedTower_->stats->damage)));
-    drawStat("Range", std::to_string(static_cast<int>(selectedTower_->stats->attackRange)));
-    drawStat("Speed", std::to_string(selectedTower_->stats->attackSpeed).substr(0, 4));
+    drawStat("Level", std::to_string(tower->upgrade->level));
+    drawStat("Damage", std::to_string(static_cast<int>(tower->stats->damage)));
+    drawStat("Range", std::to_string(static_cast<int>(tower->stats->attackRange)));
+    drawStat("Speed", std::to_string(tower->stats->attackSpeed).substr(0, 4));
     
     // Upgrade info
-    if (selectedTower_->upgrade->level < selectedTower_->upgrade->maxLevel) {
-        int upgradeCost = UpgradeSystem::getUpgradeCost(selectedTower_->upgrade->level, selectedTower_->towerType);
-        sf::Color upgradeColor = (gold_ >= upgradeCost) ? sf::Color::Green : sf::Color::Red;
+    if (tower->upgrade->level < tower->upgrade->maxLevel) {
+        int upgradeCost = UpgradeSystem::getUpgradeCost(tower->upgrade->level, tower->towerType);
+        sf::Color upgradeColor = (simulation_->getGold() >= upgradeCost) ? sf::Color::Green : sf::Color::Red;
         drawStat("Upgrade", std::to_string(upgradeCost) + "g");
     } else {
         sf::Text maxText;
@@ -933,7 +910,7 @@ void Game::renderSelectedTowerInfo() {
     }
     
     // Sell value
-    int sellValue = getTowerSellValue(selectedTower_);
+    int sellValue = simulation_->getTowerSellValue(tower);
     drawStat("Sell", std::to_string(sellValue) + "g");
     
     // Instructions
@@ -948,7 +925,8 @@ void Game::renderSelectedTowerInfo() {
 
 // Render unit info panel - COMPLETED VERSION
 void Game::renderSelectedUnitInfo() {
-    if (!selectedUnit_ || !resourceManager_->hasFont("kenney_mini")) return;
+    const auto& unit = unitSystem_->find(selectedUnit_);
+    if (!unit || !resourceManager_->hasFont("kenney_mini")) return;
     
     const sf::Font& font = resourceManager_->getFont("kenney_mini");
     
@@ -963,7 +941,7 @@ void Game::renderSelectedUnitInfo() {
     // Unit name
     sf::Text nameText;
     nameText.setFont(font);
-    nameText.setString(selectedUnit_->unitType);
+    nameText.setString(unit->unitType);
     nameText.setCharacterSize(20);
     nameText.setFillColor(sf::Color::Green);
     nameText.setPosition(window_.getSize().x - 310, 80);
@@ -982,15 +960,15 @@ void Game::renderSelectedUnitInfo() {
         yPos += 22;
     };
     
-    drawStat("Level", std::to_string(selectedUnit_->upgrade->level));
-    drawStat("HP", std::to_string(selectedUnit_->health->hp) + "/" + std::to_string(selectedUnit_->health->maxHp));
-    drawStat("Damage", std::to_string(static_cast<int>(selectedUnit_->stats->damage)));
-    drawStat("Speed", std::to_string(static_cast<int>(selectedUnit_->stats->speed)));
+    drawStat("Level", std::to_string(unit->upgrade->level));
+    drawStat("HP", std::to_string(unit->health->hp) + "/" + std::to_string(unit->health->maxHp));
+    drawStat("Damage", std::to_string(static_cast<int>(unit->stats->damage)));
+    drawStat("Speed", std::to_string(static_cast<int>(unit->stats->speed)));
     
     // Upgrade info
-    if (selectedUnit_->upgrade->level < selectedUnit_->upgrade->maxLevel) {
-        int upgradeCost = UpgradeSystem::getUpgradeCost(selectedUnit_->upgrade->level, selectedUnit_->unitType);
-        sf::Color upgradeColor = (gold_ >= upgradeCost) ? sf::Color::Green : sf::Color::Red;
+    if (unit->upgrade->level < unit->upgrade->maxLevel) {
+        int upgradeCost = UpgradeSystem::getUpgradeCost(unit->upgrade->level, unit->unitType);
+        sf::Color upgradeColor = (simulation_->getGold() >= upgradeCost) ? sf::Color::Green : sf::Color::Red;
         drawStat("Upgrade", std::to_string(upgradeCost) + "g");
     } else {
         sf::Text maxText;
@@ -1031,10 +1009,7 @@ void Game::renderMap() {
                 sf::RectangleShape tile(sf::Vector2f(map_->tileSize(), map_->tileSize()));
                 tile.setPosition(x * map_->tileSize(), y * map_->tileSize());
                 
-                int index = y * map_->cols() + x;
-                if (index < static_cast<int>(map_->grid().size())) {
-                    tile.setFillColor(map_->grid()[index] ? sf::Color(100, 100, 100) : sf::Color(50, 150, 50));
-                }
+                tile.setFillColor(map_->grid().isWalkable(x, y) ? sf::Color(100, 100, 100) : sf::Color(50, 150, 50));
                 tile.setOutlineColor(sf::Color(40, 120, 40, 100));
                 tile.setOutlineThickness(1.0f);
                 window_.draw(tile);
@@ -1065,20 +1040,17 @@ void Game::renderMap() {
     if (debugMode_) {
         for (int y = 0; y < map_->rows(); ++y) {
             for (int x = 0; x < map_->cols(); ++x) {
-                int index = y * map_->cols() + x;
-                if (index < static_cast<int>(map_->grid().size())) {
-                    sf::RectangleShape gridCell(sf::Vector2f(map_->tileSize() - 2, map_->tileSize() - 2));
-                    gridCell.setPosition(x * map_->tileSize() + 1, y * map_->tileSize() + 1);
-                    gridCell.setFillColor(sf::Color::Transparent);
-                    
-                    if (map_->grid()[index] == 0) {
-                        gridCell.setOutlineColor(sf::Color(255, 0, 0, 100));
-                    } else {
-                        gridCell.setOutlineColor(sf::Color(0, 255, 0, 50));
-                    }
-                    gridCell.setOutlineThickness(1.0f);
-                    window_.draw(gridCell);
+                sf::RectangleShape gridCell(sf::Vector2f(map_->tileSize() - 2, map_->tileSize() - 2));
+                gridCell.setPosition(x * map_->tileSize() + 1, y * map_->tileSize() + 1);
+                gridCell.setFillColor(sf::Color::Transparent);
+                
+                if (!map_->grid().isWalkable(x, y)) {
+                    gridCell.setOutlineColor(sf::Color(255, 0, 0, 100));
+                } else {
+                    gridCell.setOutlineColor(sf::Color(0, 255, 0, 50));
                 }
+                gridCell.setOutlineThickness(1.0f);
+                window_.draw(gridCell);
             }
         }
     }
@@ -1145,14 +1117,15 @@ void Game::renderTowers() {
 void Game::renderUnits() {
     for (const auto& unit : unitSystem_->getUnits()) {
         if (unit->sprite && unit->sprite->visible && unit->health->alive()) {
+            sf::Vector2f position = interpolate(unit->transform->previousPosition, unit->transform->position, renderAlpha_);
             if (unit->sprite->sprite.getTexture()) {
-                unit->sprite->sprite.setPosition(unit->transform->position);
+                unit->sprite->sprite.setPosition(position);
                 unit->sprite->sprite.setScale(0.2f, 0.2f);
                 window_.draw(unit->sprite->sprite);
             }
             
             renderHealthBar(
-                sf::Vector2f(unit->transform->position.x - 15, unit->transform->position.y - 25),
+                sf::Vector2f(position.x - 15, position.y - 25),
                 static_cast<float>(unit->health->hp) / unit->health->maxHp,
                 30.0f, 4.0f
             );
@@ -1163,14 +1136,15 @@ void Game::renderUnits() {
 void Game::renderEnemies() {
     for (const auto& enemy : enemySystem_->getEnemies()) {
         if (enemy->sprite && enemy->sprite->visible && enemy->health->alive()) {
+            sf::Vector2f position = interpolate(enemy->transform->previousPosition, enemy->transform->position, renderAlpha_);
             if (enemy->sprite->sprite.getTexture()) {
-                enemy->sprite->sprite.setPosition(enemy->transform->position);
+                enemy->sprite->sprite.setPosition(position);
                 enemy->sprite->sprite.setScale(0.2f, 0.2f);
                 window_.draw(enemy->sprite->sprite);
             }
             
             renderHealthBar(
-                sf::Vector2f(enemy->transform->position.x - 15, enemy->transform->position.y - 25),
+                sf::Vector2f(position.x - 15, position.y - 25),
                 static_cast<float>(enemy->health->hp) / enemy->health->maxHp,
                 30.0f, 4.0f
             );
@@ -1179,32 +1153,32 @@ void Game::renderEnemies() {
 }
 
 void Game::renderProjectiles() {
-    for (const auto& proj : projectileSystem_->getProjectiles()) {
-        if (proj.active) {
-            sf::CircleShape projShape(4.0f);
-            projShape.setPosition(proj.pos.x - 4, proj.pos.y - 4);
-            
-            switch (proj.type) {
-                case ProjectileData::FIREBALL:
-                    projShape.setFillColor(sf::Color(255, 150, 50));
-                    break;
-                case ProjectileData::ICE_SHARD:
-                    projShape.setFillColor(sf::Color(100, 200, 255));
-                    break;
-                case ProjectileData::POISON_DART:
-                    projShape.setFillColor(sf::Color(100, 255, 100));
-                    break;
-                case ProjectileData::LIGHTNING:
-                    projShape.setFillColor(sf::Color(255, 255, 100));
-                    break;
-                default:
-                    projShape.setFillColor(sf::Color::Yellow);
-                    break;
-            }
-            
-            window_.draw(projShape);
+    projectileSystem_->forEachProjectile([this](const ProjectileData& proj, const sf::Vector2f& previous,
+                                                const sf::Vector2f& current) {
+        sf::CircleShape projShape(4.0f);
+        sf::Vector2f position = interpolate(previous, current, renderAlpha_);
+        projShape.setPosition(position.x - 4, position.y - 4);
+        
+        switch (proj.type) {
+            case ProjectileData::FIREBALL:
+                projShape.setFillColor(sf::Color(255, 150, 50));
+                break;
+            case ProjectileData::ICE_SHARD:
+                projShape.setFillColor(sf::Color(100, 200, 255));
+                break;
+            case ProjectileData::POISON_DART:
+                projShape.setFillColor(sf::Color(100, 255, 100));
+                break;
+            case ProjectileData::LIGHTNING:
+                projShape.setFillColor(sf::Color(255, 255, 100));
+                break;
+            default:
+                projShape.setFillColor(sf::Color::Yellow);
+                break;
         }
-    }
+        
+        window_.draw(projShape);
+    });
 }
 
 void Game::renderParticles() {
@@ -1243,9 +1217,9 @@ void Game::renderTowerPlacementPreview() {
     sf::Vector2i mousePixel = sf::Mouse::getPosition(window_);
     sf::Vector2f mousePos = window_.mapPixelToCoords(mousePixel);
     
-    bool validPosition = isValidTowerPosition(mousePos);
-    int cost = getTowerCost(selectedTowerType_);
-    bool canAfford = (gold_ >= cost);
+    bool validPosition = simulation_->isValidTowerPosition(mousePos);
+    int cost = simulation_->getTowerCost(selectedTowerType_);
+    bool canAfford = (simulation_->getGold() >= cost);
     
     sf::CircleShape preview(25.0f);
     preview.setPosition(mousePos.x - 25, mousePos.y - 25);
@@ -1277,9 +1251,9 @@ void Game::renderUnitPlacementPreview() {
     sf::Vector2i mousePixel = sf::Mouse::getPosition(window_);
     sf::Vector2f mousePos = window_.mapPixelToCoords(mousePixel);
     
-    bool validPosition = isValidUnitPosition(mousePos);
-    int cost = getUnitCost(selectedUnitType_);
-    bool canAfford = (gold_ >= cost);
+    bool validPosition = simulation_->isValidUnitPosition(mousePos);
+    int cost = simulation_->getUnitCost(selectedUnitType_);
+    bool canAfford = (simulation_->getGold() >= cost);
     
     sf::CircleShape preview(20.0f);
     preview.setPosition(mousePos.x - 20, mousePos.y - 20);
@@ -1312,128 +1286,26 @@ void Game::renderFloatingTexts() {
     }
 }
 
-void Game::updateWaveSystem(float dt) {
-    if (nextWaveTimer_ > 0.0f) {
-        nextWaveTimer_ -= dt;
-        if (nextWaveTimer_ < 0.0f) nextWaveTimer_ = 0.0f;
-    }
-    
-    if (!waveInProgress_) {
-        return;
-    }
-    
-    if (waveSystem_->isActive()) {
-        waveSystem_->update(dt);
-        
-        if (waveSystem_->isFinished() && enemySystem_->getAliveCount() == 0) {
-            std::cout << "[Game] ========================================" << std::endl;
-            std::cout << "[Game] WAVE " << (currentWave_ + 1) << " COMPLETED!" << std::endl;
-            std::cout << "[Game] ========================================" << std::endl;
-            
-            waveInProgress_ = false;
-            
-            int reward = 50 + (currentWave_ * 25);
-            gold_ += reward;
-            std::cout << "[Game] Reward: " << reward << " gold (Total: " << gold_ << ")" << std::endl;
-            
-            WaveEventData data;
-            data.waveNumber = currentWave_ + 1;
-            data.goldReward = reward;
-            eventBus_->publish(Events::WAVE_COMPLETED, &data);
-            
-            currentWave_++;
-            
-            if (currentWave_ >= waveSystem_->getTotalWaves()) {
-                std::cout << "[Game] ✓✓✓ ALL WAVES COMPLETED - VICTORY! ✓✓✓" << std::endl;
-                eventBus_->publish(Events::ALL_WAVES_COMPLETED, nullptr);
-                gameStateManager_->victory();
-            } else {
-                nextWaveTimer_ = 5.0f;
-                std::cout << "[Game] Next wave ready in " << nextWaveTimer_ << " seconds" << std::endl;
-            }
-        }
-    }
-}
-
-void Game::updateEntities(float dt) {
-    for (const auto& enemy : enemySystem_->getEnemies()) {
-        enemy->update(dt);
-        if (enemy->sprite) {
-            enemy->sprite->sprite.setPosition(enemy->transform->position);
-        }
-    }
-    enemySystem_->update(dt);
-    
-    for (const auto& unit : unitSystem_->getUnits()) {
-        unit->update(dt);
-        if (unit->sprite) {
-            unit->sprite->sprite.setPosition(unit->transform->position);
-        }
-    }
-    unitSystem_->update(dt);
-    
-    for (const auto& tower : towerSystem_->getTowers()) {
-        tower->update(dt);
-    }
-    towerSystem_->update(dt);
-    
-    projectileSystem_->update(dt);
-}
-
 void Game::updateUI() {
-    uiManager_->setResources(gold_, lives_, 0);
-    uiManager_->setWaveInfo(currentWave_ + 1, waveSystem_->getTotalWaves(), 
-                            enemySystem_->getAliveCount(), nextWaveTimer_);
+    uiManager_->setResources(simulation_->getGold(), simulation_->getLives(), 0);
+    uiManager_->setWaveInfo(simulation_->getCurrentWave() + 1, simulation_->getTotalWaves(), 
+                            enemySystem_->getAliveCount(), simulation_->getNextWaveTimer());
     
-    if (!waveInProgress_ && nextWaveTimer_ <= 0.0f && currentWave_ < waveSystem_->getTotalWaves()) {
+    if (simulation_->canStartNextWave()) {
         uiManager_->showWaveReady(true);
     } else {
         uiManager_->showWaveReady(false);
     }
 }
 
-void Game::createInitialTowers() {
-    // Create UNIQUE main base tower
-    mainBaseTower_ = std::make_shared<Tower>();
-    mainBaseTower_->initializeAsType("arrow_tower");
-    mainBaseTower_->transform->position = sf::Vector2f(150, 350);
-    mainBaseTower_->sprite->visible = true;
-    mainBaseTower_->sprite->textureId = "MAIN_BASE";
-    towerSystem_->add(mainBaseTower_);
-    
-    std::cout << "[Game] Created MAIN BASE tower at (150, 350)" << std::endl;
-}
-
-void Game::spawnEnemy(const std::string& enemyId) {
-    auto enemy = std::make_shared<Enemy>();
-    enemy->initializeAsType(enemyId);
-    
-    enemy->path->path = map_->getPath();
-    enemy->path->currentIndex = 0;
-    enemy->path->finished = false;
-    
-    if (!enemy->path->path.empty()) {
-        enemy->transform->position = enemy->path->path[0];
-    }
-    
-    std::string textureId = "enemy_" + enemyId;
-    if (resourceManager_->hasTexture(textureId)) {
-        enemy->sprite->sprite.setTexture(resourceManager_->getTexture(textureId));
-        enemy->sprite->sprite.setOrigin(16, 16);
-        enemy->sprite->visible = true;
-    }
-    
-    enemySystem_->add(enemy);
-}
-
 void Game::handleMouseClickWorld(const sf::Vector2f& worldPos) {
     if (!gameStateManager_->isPlaying()) return; // Don't allow placement when paused/game over
     
     if (placingTower_) {
         std::cout << "[DEBUG] Placing TOWER: " << selectedTowerType_ << std::endl;
-        if (isValidTowerPosition(worldPos)) {
-            int cost = getTowerCost(selectedTowerType_);
-            if (gold_ >= cost) {
+        if (simulation_->isValidTowerPosition(worldPos)) {
+            int cost = simulation_->getTowerCost(selectedTowerType_);
+            if (simulation_->getGold() >= cost) {
                 if (placeTower(selectedTowerType_, worldPos)) {
                     std::cout << "[Game] Tower placed at (" << worldPos.x << ", " << worldPos.y << ")" << std::endl;
                     placingTower_ = false;
@@ -1442,7 +1314,7 @@ void Game::handleMouseClickWorld(const sf::Vector2f& worldPos) {
                     spawnFloatingText("Failed to place!", worldPos, sf::Color::Red);
                 }
             } else {
-                std::cout << "[Game] NOT ENOUGH GOLD! Need: " << cost << ", Have: " << gold_ << std::endl;
+                std::cout << "[Game] NOT ENOUGH GOLD! Need: " << cost << ", Have: " << simulation_->getGold() << std::endl;
                 spawnFloatingText("Not enough gold!", worldPos, sf::Color::Red);
             }
         } else {
@@ -1450,9 +1322,9 @@ void Game::handleMouseClickWorld(const sf::Vector2f& worldPos) {
         }
     } else if (placingUnit_) {
         std::cout << "[DEBUG] Placing UNIT: " << selectedUnitType_ << std::endl;
-        if (isValidUnitPosition(worldPos)) {
-            int cost = getUnitCost(selectedUnitType_);
-            if (gold_ >= cost) {
+        if (simulation_->isValidUnitPosition(worldPos)) {
+            int cost = simulation_->getUnitCost(selectedUnitType_);
+            if (simulation_->getGold() >= cost) {
                 if (placeUnit(selectedUnitType_, worldPos)) {
                     std::cout << "[Game] Unit placed at (" << worldPos.x << ", " << worldPos.y << ")" << std::endl;
                     placingUnit_ = false;
@@ -1461,7 +1333,7 @@ void Game::handleMouseClickWorld(const sf::Vector2f& worldPos) {
                     spawnFloatingText("Failed to place!", worldPos, sf::Color::Red);
                 }
             } else {
-                std::cout << "[Game] NOT ENOUGH GOLD! Need: " << cost << ", Have: " << gold_ << std::endl;
+                std::cout << "[Game] NOT ENOUGH GOLD! Need: " << cost << ", Have: " << simulation_->getGold() << std::endl;
                 spawnFloatingText("Not enough gold!", worldPos, sf::Color::Red);
             }
         } else {
@@ -1476,20 +1348,20 @@ void Game::handleMouseClickWorld(const sf::Vector2f& worldPos) {
 // NEW: Select tower or unit
 void Game::selectEntity(const sf::Vector2f& worldPos) {
     // Try to select tower first
-    auto tower = getTowerAtPosition(worldPos);
+    auto tower = simulation_->getTowerAtPosition(worldPos);
     if (tower) {
         if (selectedTower_) {
             // Deselect previous tower
-            selectedTower_ = nullptr;
+            selectedTower_ = EntityHandle();
             showTowerInfo_ = false;
         }
         if (selectedUnit_) {
             // Deselect unit if selecting tower
-            selectedUnit_ = nullptr;
+            selectedUnit_ = EntityHandle();
             showUnitInfo_ = false;
         }
         
-        selectedTower_ = tower;
+        selectedTower_ = tower->handle;
         showTowerInfo_ = true;
         
         std::cout << "[Game] Selected " << tower->towerType << std::endl;
@@ -1498,20 +1370,20 @@ void Game::selectEntity(const sf::Vector2f& worldPos) {
     }
     
     // Try to select unit
-    auto unit = getUnitAtPosition(worldPos);
+    auto unit = simulation_->getUnitAtPosition(worldPos);
     if (unit) {
         if (selectedTower_) {
             // Deselect tower if selecting unit
-            selectedTower_ = nullptr;
+            selectedTower_ = EntityHandle();
             showTowerInfo_ = false;
         }
         if (selectedUnit_) {
             // Deselect previous unit
-            selectedUnit_ = nullptr;
+            selectedUnit_ = EntityHandle();
             showUnitInfo_ = false;
         }
         
-        selectedUnit_ = unit;
+        selectedUnit_ = unit->handle;
         showUnitInfo_ = true;
         
         std::cout << "[Game] Selected " << unit->unitType << std::endl;
@@ -1527,7 +1399,7 @@ void Game::deselectTower() {
     if (selectedTower_) {
         std::cout << "[Game] Deselected tower" << std::endl;
     }
-    selectedTower_ = nullptr;
+    selectedTower_ = EntityHandle();
     showTowerInfo_ = false;
 }
 
@@ -1535,7 +1407,7 @@ void Game::deselectUnit() {
     if (selectedUnit_) {
         std::cout << "[Game] Deselected unit" << std::endl;
     }
-    selectedUnit_ = nullptr;
+    selectedUnit_ = EntityHandle();
     showUnitInfo_ = false;
 }
 
@@ -1547,335 +1419,118 @@ void Game::deselectAll() {
     
     if (selectedTower_) {
         std::cout << "[Game] Deselected tower" << std::endl;
-        selectedTower_ = nullptr;
+        selectedTower_ = EntityHandle();
         showTowerInfo_ = false;
     }
     
     if (selectedUnit_) {
         std::cout << "[Game] Deselected unit" << std::endl;
-        selectedUnit_ = nullptr;
+        selectedUnit_ = EntityHandle();
         showUnitInfo_ = false;
     }
 }
 
 
-std::shared_ptr<Tower> Game::getTowerAtPosition(const sf::Vector2f& worldPos) {
-    for (const auto& tower : towerSystem_->getTowers()) {
-        sf::Vector2f diff = tower->transform->position - worldPos;
-        float distanceSq = diff.x * diff.x + diff.y * diff.y;
-        float radiusSq = 50.0f * 50.0f;
-        
-        if (distanceSq <= radiusSq) {
-            return tower;
-        }
-    }
-    return nullptr;
-}
-
-std::shared_ptr<Unit> Game::getUnitAtPosition(const sf::Vector2f& worldPos) {
-    for (const auto& unit : unitSystem_->getUnits()) {
-        if (!unit->health->alive()) continue;
-        
-        sf::Vector2f diff = unit->transform->position - worldPos;
-        float distanceSq = diff.x * diff.x + diff.y * diff.y;
-        float radiusSq = 30.0f * 30.0f;
-        
-        if (distanceSq <= radiusSq) {
-            return unit;
-        }
-    }
-    return nullptr;
-}
-
-int Game::getTowerCost(const std::string& towerType) {
-    if (towerType == "arrow_tower") return 100;
-    if (towerType == "cannon_tower") return 200;
-    if (towerType == "mage_tower") return 300;
-    if (towerType == "ice_tower") return 250;
-    if (towerType == "lightning_tower") return 400;
-    if (towerType == "poison_tower") return 350;
-    if (towerType == "ballista") return 450;
-    if (towerType == "flame_tower") return 500;
-    if (towerType == "tesla_tower") return 600;
-    if (towerType == "arcane_tower") return 800;
-    if (towerType == "sniper_tower") return 700;
-    if (towerType == "artillery_tower") return 1000;
-    return 100;
-}
-
-int Game::getUnitCost(const std::string& unitType) {
-    if (unitType == "archer") return 80;
-    if (unitType == "knight") return 120;
-    if (unitType == "mage") return 150;
-    if (unitType == "rogue") return 100;
-    if (unitType == "paladin") return 180;
-    if (unitType == "ranger") return 130;
-    if (unitType == "berserker") return 160;
-    if (unitType == "priest") return 140;
-    if (unitType == "necromancer") return 170;
-    if (unitType == "druid") return 190;
-    if (unitType == "engineer") return 210;
-    if (unitType == "monk") return 220;
-    return 80;
-}
-
-int Game::getTowerSellValue(const std::shared_ptr<Tower>& tower) {
-    int baseCost = getTowerCost(tower->towerType);
-    
-    int upgradeCosts = 0;
-    if (tower->upgrade && tower->upgrade->level > 1) {
-        for (int i = 1; i < tower->upgrade->level; i++) {
-            upgradeCosts += baseCost * (i + 1);
-        }
-    }
-    
-    return static_cast<int>((baseCost + upgradeCosts) * 0.75f);
-}
-
 void Game::sellSelectedTower() {
-    if (!selectedTower_) return;
+    const auto& tower = towerSystem_->find(selectedTower_);
+    if (!tower) return;
     
-    if (selectedTower_ == mainBaseTower_ || selectedTower_->sprite->textureId == "MAIN_BASE") {
+    if (simulation_->isMainBase(tower)) {
         std::cout << "[Game] Cannot sell the MAIN BASE tower!" << std::endl;
-        spawnFloatingText("Cannot sell base!", selectedTower_->transform->position, sf::Color::Red);
+        spawnFloatingText("Cannot sell base!", tower->transform->position, sf::Color::Red);
         return;
     }
     
-    int refund = getTowerSellValue(selectedTower_);
-    gold_ += refund;
-    
-    std::cout << "[Game] Sold " << selectedTower_->towerType << " for " << refund << " gold (Total: " << gold_ << ")" << std::endl;
+    std::string towerType = tower->towerType;
+    sf::Vector2f position = tower->transform->position;
+    int refund = simulation_->sellTower(selectedTower_);
+    if (refund < 0) return;
     
-    particleSystem_->emitExplosion(selectedTower_->transform->position, 30.0f);
-    showGoldText(refund, selectedTower_->transform->position);
-    spawnFloatingText("SOLD!", selectedTower_->transform->position, sf::Color::Yellow);
+    std::cout << "[Game] Sold " << towerType << " for " << refund << " gold (Total: " << simulation_->getGold() << ")" << std::endl;
     
-    auto& towers = towerSystem_->getTowersModifiable();
-    towers.erase(std::remove(towers.begin(), towers.end(), selectedTower_), towers.end());
+    particleSystem_->emitExplosion(position, 30.0f);
+    showGoldText(refund, position);
+    spawnFloatingText("SOLD!", position, sf::Color::Yellow);
     
     deselectTower();
 }
 
 // NEW: Upgrade selected tower
 void Game::upgradeSelectedTower() {
-    if (!selectedTower_) return;
+    const auto& tower = towerSystem_->find(selectedTower_);
+    if (!tower) return;
     
-    if (selectedTower_->upgrade->level >= selectedTower_->upgrade->maxLevel) {
+    if (tower->upgrade->level >= tower->upgrade->maxLevel) {
         std::cout << "[Game] Tower already at max level!" << std::endl;
-        spawnFloatingText("MAX LEVEL!", selectedTower_->transform->position, sf::Color::Cyan);
+        spawnFloatingText("MAX LEVEL!", tower->transform->position, sf::Color::Cyan);
         return;
     }
     
-    if (UpgradeSystem::upgradeTower(selectedTower_, gold_)) {
-        std::cout << "[Game] Upgraded " << selectedTower_->towerType 
-                  << " to level " << selectedTower_->upgrade->level 
-                  << " (Gold: " << gold_ << ")" << std::endl;
+    if (simulation_->upgradeTower(selectedTower_)) {
+        std::cout << "[Game] Upgraded " << tower->towerType 
+                  << " to level " << tower->upgrade->level 
+                  << " (Gold: " << simulation_->getGold() << ")" << std::endl;
         
-        particleSystem_->emit(selectedTower_->transform->position, Particle::SPARKLE, 20);
-        spawnFloatingText("UPGRADED!", selectedTower_->transform->position, sf::Color::Cyan);
+        particleSystem_->emit(tower->transform->position, Particle::SPARKLE, 20);
+        spawnFloatingText("UPGRADED!", tower->transform->position, sf::Color::Cyan);
     } else {
-        int cost = UpgradeSystem::getUpgradeCost(selectedTower_->upgrade->level - 1, selectedTower_->towerType);
-        std::cout << "[Game] Cannot upgrade! Need: " << cost << "g, Have: " << gold_ << "g" << std::endl;
-        spawnFloatingText("Not enough gold!", selectedTower_->transform->position, sf::Color::Red);
+        int cost = UpgradeSystem::getUpgradeCost(tower->upgrade->level - 1, tower->towerType);
+        std::cout << "[Game] Cannot upgrade! Need: " << cost << "g, Have: " << simulation_->getGold() << "g" << std::endl;
+        spawnFloatingText("Not enough gold!", tower->transform->position, sf::Color::Red);
     }
 }
 
 // NEW: Upgrade selected unit
 void Game::upgradeSelectedUnit() {
-    if (!selectedUnit_) return;
+    const auto& unit = unitSystem_->find(selectedUnit_);
+    if (!unit) return;
     
-    if (selectedUnit_->upgrade->level >= selectedUnit_->upgrade->maxLevel) {
+    if (unit->upgrade->level >= unit->upgrade->maxLevel) {
         std::cout << "[Game] Unit already at max level!" << std::endl;
-        spawnFloatingText("MAX LEVEL!", selectedUnit_->transform->position, sf::Color::Cyan);
+        spawnFloatingText("MAX LEVEL!", unit->transform->position, sf::Color::Cyan);
         return;
     }
     
-    if (UpgradeSystem::upgradeUnit(selectedUnit_, gold_)) {
-        std::cout << "[Game] Upgraded " << selectedUnit_->unitType 
-                  << " to level " << selectedUnit_->upgrade->level 
-                  << " (Gold: " << gold_ << ")" << std::endl;
+    if (simulation_->upgradeUnit(selectedUnit_)) {
+        std::cout << "[Game] Upgraded " << unit->unitType 
+                  << " to level " << unit->upgrade->level 
+                  << " (Gold: " << simulation_->getGold() << ")" << std::endl;
         
-        particleSystem_->emit(selectedUnit_->transform->position, Particle::SPARKLE, 20);
-        spawnFloatingText("UPGRADED!", selectedUnit_->transform->position, sf::Color::Cyan);
+        particleSystem_->emit(unit->transform->position, Particle::SPARKLE, 20);
+        spawnFloatingText("UPGRADED!", unit->transform->position, sf::Color::Cyan);
     } else {
-        int cost = UpgradeSystem::getUpgradeCost(selectedUnit_->upgrade->level - 1, selectedUnit_->unitType);
-        std::cout << "[Game] Cannot upgrade! Need: " << cost << "g, Have: " << gold_ << "g" << std::endl;
-        spawnFloatingText("Not enough gold!", selectedUnit_->transform->position, sf::Color::Red);
+        int cost = UpgradeSystem::getUpgradeCost(unit->upgrade->level - 1, unit->unitType);
+        std::cout << "[Game] Cannot upgrade! Need: " << cost << "g, Have: " << simulation_->getGold() << "g" << std::endl;
+        spawnFloatingText("Not enough gold!", unit->transform->position, sf::Color::Red);
     }
 }
 
-bool Game::isValidTowerPosition(const sf::Vector2f& position) {
-    float mapWidth = map_->cols() * map_->tileSize();
-    float mapHeight = map_->rows() * map_->tileSize();
-    
-    if (position.x < 0 || position.x > mapWidth || 
-        position.y < 0 || position.y > mapHeight) {
-        return false;
-    }
-    
-    bool buildable = map_->isValidBuildPosition(position);
-    if (!buildable) {
-        return false;
-    }
-    
-    for (const auto& tower : towerSystem_->getTowers()) {
-        float dx = position.x - tower->transform->position.x;
-        float dy = position.y - tower->transform->position.y;
-        float distance = std::sqrt(dx * dx + dy * dy);
-        if (distance < 60.0f) {
-            return false;
-        }
-    }
-    
-    float minPathDistance = 999999.0f;
-    for (const auto& pathPoint : map_->getPath()) {
-        float dx = position.x - pathPoint.x;
-        float dy = position.y - pathPoint.y;
-        float distance = std::sqrt(dx * dx + dy * dy);
-        if (distance < minPathDistance) {
-            minPathDistance = distance;
-        }
-    }
-    
-    if (minPathDistance < 20.0f) {
-        return false;
-    }
-    
-    return true;
-}
-
 // NEW: Validate unit position
-bool Game::isValidUnitPosition(const sf::Vector2f& position) {
-    float mapWidth = map_->cols() * map_->tileSize();
-    float mapHeight = map_->rows() * map_->tileSize();
-    
-    // Must be within map bounds
-    if (position.x < 0 || position.x > mapWidth || 
-        position.y < 0 || position.y > mapHeight) {
-        return false;
-    }
-    
-    // Cannot be on path (must be on buildable ground)
-    bool buildable = map_->isValidBuildPosition(position);
-    if (!buildable) {
-        return false;
-    }
-    
-    // Cannot be too close to towers
-    for (const auto& tower : towerSystem_->getTowers()) {
-        float dx = position.x - tower->transform->position.x;
-        float dy = position.y - tower->transform->position.y;
-        float distance = std::sqrt(dx * dx + dy * dy);
-        if (distance < 50.0f) {
-            return false;
-        }
-    }
-    
-    // Cannot be too close to other units
-    for (const auto& unit : unitSystem_->getUnits()) {
-        float dx = position.x - unit->transform->position.x;
-        float dy = position.y - unit->transform->position.y;
-        float distance = std::sqrt(dx * dx + dy * dy);
-        if (distance < 30.0f) {
-            return false;
-        }
-    }
-    
-    return true;
-}
-
 bool Game::placeTower(const std::string& towerType, const sf::Vector2f& position) {
-    if (!isValidTowerPosition(position)) {
-        return false;
-    }
-    
-    int cost = getTowerCost(towerType);
-    
-    if (gold_ < cost) {
-        std::cout << "[Game] Not enough gold. Need: " << cost << ", Have: " << gold_ << std::endl;
-        return false;
-    }
-    
-    if (!towerSystem_->canPlaceTower(position)) {
+    auto tower = simulation_->placeTower(towerType, position);
+    if (!tower) {
         return false;
     }
     
-    auto tower = std::make_shared<Tower>();
-    tower->initializeAsType(towerType);
-    tower->transform->position = position;
-    
-    std::string textureId = "tower_" + towerType;
-    size_t pos = textureId.find("_tower");
-    if (pos != std::string::npos) {
-        textureId.erase(pos, 6);
-    }
-    
-    if (resourceManager_->hasTexture(textureId)) {
-        tower->sprite->sprite.setTexture(resourceManager_->getTexture(textureId));
-        tower->sprite->sprite.setOrigin(32, 32);
-        tower->sprite->visible = true;
-    }
-    
-    towerSystem_->add(tower);
-    
-    // CRITICAL FIX: Deduct gold AFTER adding tower
-    gold_ -= cost;
-    std::cout << "[Game] ✓ TOWER PLACED - Deducted " << cost << " gold. Remaining: " << gold_ << std::endl;
-    
-    TowerEventData data;
-    data.tower = tower;
-    data.position = position;
-    data.towerType = towerType;
-    data.cost = cost;
-    eventBus_->publish(Events::TOWER_PLACED, &data);
-    
+    applyTowerTexture(tower);
     return true;
 }
 
 // NEW: Place unit
 bool Game::placeUnit(const std::string& unitType, const sf::Vector2f& position) {
-    if (!isValidUnitPosition(position)) {
+    auto unit = simulation_->placeUnit(unitType, position);
+    if (!unit) {
         return false;
     }
     
-    int cost = getUnitCost(unitType);
-    
-    if (gold_ < cost) {
-        std::cout << "[Game] Not enough gold. Need: " << cost << ", Have: " << gold_ << std::endl;
-        return false;
-    }
-    
-    auto unit = std::make_shared<Unit>();
-    unit->initializeAsType(unitType);
-    unit->transform->position = position;
-    
-    std::string textureId = "unit_" + unitType;
-    if (resourceManager_->hasTexture(textureId)) {
-        unit->sprite->sprite.setTexture(resourceManager_->getTexture(textureId));
-        unit->sprite->sprite.setOrigin(16, 16);
-        unit->sprite->visible = true;
-    }
-    
-    unitSystem_->add(unit);
-    
-    // CRITICAL FIX: Deduct gold AFTER adding unit
-    gold_ -= cost;
-    std::cout << "[Game] ✓ UNIT PLACED - Deducted " << cost << " gold. Remaining: " << gold_ << std::endl;
-    
+    applyUnitTexture(unit);
     particleSystem_->emitExplosion(position, 15.0f);
     
     return true;
 }
 
 void Game::startNextWave() {
-    if (currentWave_ < waveSystem_->getTotalWaves() && !waveInProgress_) {
-        waveSystem_->start(currentWave_);
-        waveInProgress_ = true;
-        nextWaveTimer_ = 0.0f;
-        std::cout << "[Game] ========================================" << std::endl;
-        std::cout << "[Game] Starting wave " << (currentWave_ + 1) << " of " << waveSystem_->getTotalWaves() << std::endl;
-        std::cout << "[Game] ========================================" << std::endl;
-    }
+    simulation_->startNextWave();
 }
 
 void Game::restartGame() {
@@ -1883,25 +1538,12 @@ void Game::restartGame() {
     std::cout << "[Game] RESTARTING GAME" << std::endl;
     std::cout << "[Game] ========================================" << std::endl;
     
-    towerSystem_->getTowersModifiable().clear();
-    unitSystem_->getUnitsModifiable().clear();
-    projectileSystem_->clear();
+    simulation_->restart();
+    timeStep_.reset();
+    renderAlpha_ = 0.0f;
     particleSystem_->clear();
     floatingTexts_.clear();
     
-    auto& enemies = enemySystem_->getEnemies();
-    for (auto& enemy : enemies) {
-        if (enemy && enemy->health) {
-            enemy->health->hp = 0;
-        }
-    }
-    enemySystem_->removeDead();
-    
-    gold_ = 500;
-    lives_ = 20;
-    currentWave_ = 0;
-    nextWaveTimer_ = 0.0f;
-    waveInProgress_ = false;
     placingTower_ = false;
     placingUnit_ = false;
     selectedTowerType_.clear();
@@ -1910,11 +1552,11 @@ void Game::restartGame() {
     
     gameStateManager_->restart();
     
-    createInitialTowers();
     setupEntityTextures();
     
     std::cout << "[Game] Game restarted successfully!" << std::endl;
-    std::cout << "[Game] Gold: " << gold_ << ", Lives: " << lives_ << ", Wave: " << currentWave_ << std::endl;
+    std::cout << "[Game] Gold: " << simulation_->getGold() << ", Lives: " << simulation_->getLives()
+              << ", Wave: " << simulation_->getCurrentWave() << std::endl;
 }
 
 void Game::applyScreenShake(float intensity, float duration) {
@@ -1987,61 +1629,14 @@ void Game::showGoldText(int gold, const sf::Vector2f& position) {
 }
 
 void Game::quickSave() {
-    GameSaveData saveData;
-    saveData.gold = gold_;
-    saveData.lives = lives_;
-    saveData.currentWave = currentWave_;
-    saveData.score = 0;
-    saveData.nextWaveTimer = nextWaveTimer_;
-    saveData.waveInProgress = waveInProgress_;
-    saveData.currentMap = "forest_path";
-    
-    std::vector<std::shared_ptr<Tower>> towersCopy;
-    for (const auto& tower : towerSystem_->getTowers()) {
-        towersCopy.push_back(tower);
-    }
-    
-    std::vector<std::shared_ptr<Unit>> unitsCopy;
-    for (const auto& unit : unitSystem_->getUnits()) {
-        unitsCopy.push_back(unit);
-    }
-    
-    if (SaveLoadSystem::saveGame("quicksave.json", saveData, towersCopy, unitsCopy)) {
+    if (simulation_->save("quicksave.json")) {
         std::cout << "[Game] Quick save successful!" << std::endl;
         spawnFloatingText("Game Saved!", sf::Vector2f(320, 100), sf::Color::Cyan);
     }
 }
 
 void Game::quickLoad() {
-    GameSaveData saveData;
-    std::vector<std::shared_ptr<Tower>> towers;
-    std::vector<std::shared_ptr<Unit>> units;
-    
-    if (SaveLoadSystem::loadGame("quicksave.json", saveData, towers, units)) {
-        gold_ = saveData.gold;
-        lives_ = saveData.lives;
-        currentWave_ = saveData.currentWave;
-        nextWaveTimer_ = saveData.nextWaveTimer;
-        waveInProgress_ = saveData.waveInProgress;
-        
-        auto& enemies = enemySystem_->getEnemies();
-        for (auto& enemy : enemies) {
-            if (enemy && enemy->health) {
-                enemy->health->hp = 0;
-            }
-        }
-        enemySystem_->removeDead();
-        
-        towerSystem_->getTowersModifiable().clear();
-        for (const auto& tower : towers) {
-            towerSystem_->add(tower);
-        }
-
-        unitSystem_->getUnitsModifiable().clear();
-        for (const auto& unit : units) {
-            unitSystem_->add(unit);
-        }
-        
+    if (simulation_->load("quicksave.json")) {
         deselectAll();
         setupEntityTextures();
         std::cout << "[Game] Quick load successful!" << std::endl;
@@ -2057,8 +1652,8 @@ int Game::run() {
         sf::Time elapsed = clock_.restart();
         float dt = elapsed.asSeconds();
         
-        // Cap delta time to prevent spiral of death
-        if (dt > 0.1f) dt = 0.1f;
+        // Presentation runs on frame time; the fixed step caps how much simulation it can owe
+        if (dt > 0.25f) dt = 0.25f;
         
         // Process events
         sf::Event event;
@@ -2080,11 +1675,13 @@ int Game::run() {
         
         // Update game
         if (gameStateManager_->isPlaying()) {
-            updateEntities(dt);
-            updateWaveSystem(dt);
+            int ticks = timeStep_.advance(dt);
+            for (int i = 0; i < ticks; ++i) {
+                simulation_->step(timeStep_.delta());
+            }
+            renderAlpha_ = timeStep_.alpha();
             updateScreenEffects(dt);
             updateFloatingTexts(dt);
-            collisionSystem_->update(dt);
             particleSystem_->update(dt);
             
             // AnimationSystem update is handled per-entity, not globally
@@ -2103,34 +1700,37 @@ int Game::run() {
 void Game::setupEventSubscriptions() {
     std::cout << "[Game] Setting up event subscriptions..." << std::endl;
     
+    // Gold and lives are settled by the simulation; these are the visuals on top
+    eventBus_->subscribe(Events::ENEMY_SPAWNED, [this](const std::string& topic, void* data) {
+        EnemyEventData* eventData = static_cast<EnemyEventData*>(data);
+        if (eventData) {
+            const auto& enemy = enemySystem_->find(eventData->enemy);
+            if (enemy) applyEnemyTexture(enemy);
+        }
+    });
+    
     // Enemy death - FIXED: EventBus callback signature requires (topic, data)
     eventBus_->subscribe(Events::ENEMY_DIED, [this](const std::string& topic, void* data) {
         EnemyEventData* eventData = static_cast<EnemyEventData*>(data);
         if (eventData) {
-            gold_ += eventData->goldReward;
-            std::cout << "[Game] Enemy died! Gold: +" << eventData->goldReward 
-                      << " (Total: " << gold_ << ")" << std::endl;
-            
-            if (eventData->enemy && eventData->enemy->transform) {
-                showGoldText(eventData->goldReward, eventData->enemy->transform->position);
-                particleSystem_->emitExplosion(eventData->enemy->transform->position, 20.0f);
-            }
+            showGoldText(eventData->goldReward, eventData->position);
+            particleSystem_->emitExplosion(eventData->position, 20.0f);
         }
     });
     
     // Enemy reached end - FIXED: Correct callback signature
     eventBus_->subscribe(Events::ENEMY_REACHED_END, [this](const std::string& topic, void* data) {
-        lives_--;
-        std::cout << "[Game] Enemy reached end! Lives remaining: " << lives_ << std::endl;
-        
-        if (lives_ <= 0) {
-            std::cout << "[Game] ✗✗✗ GAME OVER ✗✗✗" << std::endl;
-            gameStateManager_->defeat(); // FIXED: Correct method name
-        }
-        
         applyScreenShake(10.0f, 0.3f);
     });
     
+    eventBus_->subscribe(Events::GAME_DEFEAT, [this](const std::string& topic, void* data) {
+        gameStateManager_->defeat(); // FIXED: Correct method name
+    });
+    
+    eventBus_->subscribe(Events::ALL_WAVES_COMPLETED, [this](const std::string& topic, void* data) {
+        gameStateManager_->victory();
+    });
+    
     // Tower placed - FIXED: Correct callback signature
     eventBus_->subscribe(Events::TOWER_PLACED, [this](const std::string& topic, void* data) {
         TowerEventData* eventData = static_cast<TowerEventData*>(data);
@@ -2149,49 +1749,56 @@ void Game::setupGameCallbacks() {
 void Game::setupEntityTextures() {
     std::cout << "[Game] Setting up entity textures..." << std::endl;
     
-    // Setup tower textures
     for (const auto& tower : towerSystem_->getTowers()) {
-        if (tower->sprite && tower->sprite->textureId != "MAIN_BASE") {
-            std::string textureId = "tower_" + tower->towerType;
-            // Remove "_tower" suffix if it exists
-            size_t pos = textureId.find("_tower");
-            if (pos != std::string::npos) {
-                textureId.erase(pos, 6);
-            }
-            
-            if (resourceManager_->hasTexture(textureId)) {
-                tower->sprite->sprite.setTexture(resourceManager_->getTexture(textureId));
-                tower->sprite->sprite.setOrigin(32, 32);
-                tower->sprite->visible = true;
-            }
-        }
+        applyTowerTexture(tower);
     }
     
-    // Setup unit textures
     for (const auto& unit : unitSystem_->getUnits()) {
-        if (unit->sprite) {
-            std::string textureId = "unit_" + unit->unitType;
-            
-            if (resourceManager_->hasTexture(textureId)) {
-                unit->sprite->sprite.setTexture(resourceManager_->getTexture(textureId));
-                unit->sprite->sprite.setOrigin(16, 16);
-                unit->sprite->visible = true;
-            }
-        }
+        applyUnitTexture(unit);
     }
     
-    // Setup enemy textures
     for (const auto& enemy : enemySystem_->getEnemies()) {
-        if (enemy->sprite) {
-            std::string textureId = "enemy_" + enemy->enemyType;
-            
-            if (resourceManager_->hasTexture(textureId)) {
-                enemy->sprite->sprite.setTexture(resourceManager_->getTexture(textureId));
-                enemy->sprite->sprite.setOrigin(16, 16);
-                enemy->sprite->visible = true;
-            }
-        }
+        applyEnemyTexture(enemy);
     }
     
     std::cout << "[Game] Entity textures setup complete" << std::endl;
+}
+
+void Game::applyTowerTexture(const std::shared_ptr<Tower>& tower) {
+    if (!tower->sprite || tower->sprite->textureId == "MAIN_BASE") return;
+    
+    std::string textureId = "tower_" + tower->towerType;
+    // Remove "_tower" suffix if it exists
+    size_t pos = textureId.find("_tower");
+    if (pos != std::string::npos) {
+        textureId.erase(pos, 6);
+    }
+    
+    if (resourceManager_->hasTexture(textureId)) {
+        tower->sprite->sprite.setTexture(resourceManager_->getTexture(textureId));
+        tower->sprite->sprite.setOrigin(32, 32);
+        tower->sprite->visible = true;
+    }
+}
+
+void Game::applyUnitTexture(const std::shared_ptr<Unit>& unit) {
+    if (!unit->sprite) return;
+    
+    std::string textureId = "unit_" + unit->unitType;
+    if (resourceManager_->hasTexture(textureId)) {
+        unit->sprite->sprite.setTexture(resourceManager_->getTexture(textureId));
+        unit->sprite->sprite.setOrigin(16, 16);
+        unit->sprite->visible = true;
+    }
+}
+
+void Game::applyEnemyTexture(const std::shared_ptr<Enemy>& enemy) {
+    if (!enemy->sprite) return;
+    
+    std::string textureId = "enemy_" + enemy->enemyType;
+    if (resourceManager_->hasTexture(textureId)) {
+        enemy->sprite->sprite.setTexture(resourceManager_->getTexture(textureId));
+        enemy->sprite->sprite.setOrigin(16, 16);
+        enemy->sprite->visible = true;
+    }
 }
\ No newline at end of file
@@ -2,16 +2,17 @@
 #include <memory>
 #include <vector>
 #include <SFML/Graphics.hpp>
+#include "../core/EntityHandle.hpp"
+#include "../core/TimeStep.hpp"
 
 // Forward declarations
-class PathfindingSystem;
+class Simulation;
 class ProjectileSystem;
 class EnemySystem;
 class TowerSystem;
 class UnitSystem;
 class RenderSystem;
 class AnimationSystem;
-class CollisionSystem;
 class ParticleSystem;
 class WaveSystem;
 class UIManager;
@@ -38,36 +39,32 @@ struct FloatingText {
 
 class Game {
 private:
-    // Core Systems
-    std::unique_ptr<PathfindingSystem> pathfindingSystem_;
-    std::unique_ptr<ProjectileSystem> projectileSystem_;
-    std::unique_ptr<EnemySystem> enemySystem_;
-    std::unique_ptr<TowerSystem> towerSystem_;
-    std::unique_ptr<UnitSystem> unitSystem_;
+    // Presentation Systems
     std::unique_ptr<RenderSystem> renderSystem_;
     std::unique_ptr<AnimationSystem> animationSystem_;
-    std::unique_ptr<CollisionSystem> collisionSystem_;
     std::unique_ptr<ParticleSystem> particleSystem_;
-    std::unique_ptr<WaveSystem> waveSystem_;
     std::unique_ptr<UIManager> uiManager_;
-    std::unique_ptr<EventBus> eventBus_;
     std::unique_ptr<ResourceManager> resourceManager_;
-    std::unique_ptr<Map> map_;
     std::unique_ptr<GameStateManager> gameStateManager_;
     std::unique_ptr<CameraSystem> cameraSystem_;
     std::unique_ptr<InputHandler> inputHandler_;
 
+    // Gameplay state and systems; the raw pointers are owned by simulation_
+    std::unique_ptr<Simulation> simulation_;
+    ProjectileSystem* projectileSystem_ = nullptr;
+    EnemySystem* enemySystem_ = nullptr;
+    TowerSystem* towerSystem_ = nullptr;
+    UnitSystem* unitSystem_ = nullptr;
+    WaveSystem* waveSystem_ = nullptr;
+    EventBus* eventBus_ = nullptr;
+    Map* map_ = nullptr;
+
     // Window and state
     sf::RenderWindow window_;
     bool running_;
     sf::Clock clock_;
-
-    // Game state variables
-    int gold_;
-    int lives_;
-    int currentWave_;
-    float nextWaveTimer_;
-    bool waveInProgress_;
+    FixedTimeStep timeStep_;
+    float renderAlpha_ = 0.0f;  // 0..1 between the previous and current simulation tick
 
     // Tower placement
     std::string selectedTowerType_;
@@ -78,12 +75,11 @@ private:
     bool placingUnit_;
 
     // Tower selection & selling
-    std::shared_ptr<Tower> selectedTower_;
+    EntityHandle selectedTower_;
     bool showTowerInfo_;
-    std::shared_ptr<Tower> mainBaseTower_;
 
     // Unit selection
-    std::shared_ptr<Unit> selectedUnit_;
+    EntityHandle selectedUnit_;
     bool showUnitInfo_;
 
     // Screen effects
@@ -102,28 +98,17 @@ private:
     bool debugMode_;
 
     // Private methods
-    void createInitialTowers();
-    void spawnEnemy(const std::string& enemyId);
-    void updateWaveSystem(float dt);
-    void updateEntities(float dt);
     void updateUI();
     void handleMouseClickWorld(const sf::Vector2f& worldPos);
     
     // Tower methods
-    bool isValidTowerPosition(const sf::Vector2f& position);
     bool placeTower(const std::string& towerType, const sf::Vector2f& position);
-    int getTowerCost(const std::string& towerType);
-    int getTowerSellValue(const std::shared_ptr<Tower>& tower);
-    std::shared_ptr<Tower> getTowerAtPosition(const sf::Vector2f& worldPos);
     void sellSelectedTower();
     void upgradeSelectedTower();
     void deselectTower();
     
     // Unit methods
-    bool isValidUnitPosition(const sf::Vector2f& position);
     bool placeUnit(const std::string& unitType, const sf::Vector2f& position);
-    int getUnitCost(const std::string& unitType);
-    std::shared_ptr<Unit> getUnitAtPosition(const sf::Vector2f& worldPos);
     void upgradeSelectedUnit();
     void deselectUnit();
     
@@ -139,6 +124,9 @@ private:
     void spawnFloatingText(const std::string& text, const sf::Vector2f& position, const sf::Color& color);
     void setupEntityAnimations();
     void setupEntityTextures();
+    void applyTowerTexture(const std::shared_ptr<Tower>& tower);
+    void applyUnitTexture(const std::shared_ptr<Unit>& unit);
+    void applyEnemyTexture(const std::shared_ptr<Enemy>& enemy);
     void setupEventSubscriptions();
     void setupInputBindings();
     void setupGameCallbacks();
@@ -172,6 +160,7 @@ public:
     int run();
     void render();
     sf::RenderWindow& getWindow() { return window_; }
+    void setTickRate(float tickRate) { timeStep_.setTickRate(tickRate); }
     
     // Public methods for effects
     void triggerScreenShake(float intensity = 5.0f, float duration = 0.3f);
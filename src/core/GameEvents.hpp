@@ -2,6 +2,7 @@
 #include <string>
 #include <SFML/System/Vector2.hpp>
 #include <memory>
+#include "../core/EntityHandle.hpp"
 // Forward declarations
 class Enemy;
 class Tower;
@@ -40,20 +41,21 @@ namespace Events {
 }
 // Event Data Structures
 struct EnemyEventData {
-    std::shared_ptr<Enemy> enemy;
+    EntityHandle enemy;  // already stale for ENEMY_DIED; use position
     sf::Vector2f position;
     std::string enemyType;
     int goldReward;
+    std::string killedBy;  // ENEMY_DIED: tower/unit type that landed the last hit
 };
 struct TowerEventData {
-    std::shared_ptr<Tower> tower;
+    EntityHandle tower;
     sf::Vector2f position;
     std::string towerType;
     int level;
     int cost;
 };
 struct UnitEventData {
-    std::shared_ptr<Unit> unit;
+    EntityHandle unit;
     sf::Vector2f position;
     std::string unitType;
     int level;
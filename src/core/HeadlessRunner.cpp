@@ -0,0 +1,89 @@
+#include "../core/HeadlessRunner.hpp"
+#include "../core/Simulation.hpp"
+#include "../systems/EnemySystem.hpp"
+#include "../systems/ProjectileSystem.hpp"
+#include "../json/json.hpp"
+#include "../utils/QuietLog.hpp"
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+using json = nlohmann::json;
+
+HeadlessRunner::HeadlessRunner(const std::string& scriptPath, bool verbose)
+    : scriptPath_(scriptPath), verbose_(verbose), mapId_("forest_path"),
+      tickRate_(60.0f), maxTicks_(1000000) {}
+
+bool HeadlessRunner::loadScript() {
+    std::ifstream file(scriptPath_);
+    if (!file.is_open()) {
+        std::cerr << "[Headless] ERROR: Cannot open script: " << scriptPath_ << std::endl;
+        return false;
+    }
+
+    try {
+        json data;
+        file >> data;
+        mapId_ = data.value("map", mapId_);
+        tickRate_ = data.value("tick_rate", tickRate_);
+        maxTicks_ = data.value("max_ticks", maxTicks_);
+
+        script_.loadPlacements(data.value("placements", json::array()));
+    } catch (const std::exception& e) {
+        std::cerr << "[Headless] ERROR: Invalid script " << scriptPath_ << ": " << e.what() << std::endl;
+        return false;
+    }
+
+    if (tickRateOverride_ > 0.0f) tickRate_ = tickRateOverride_;
+    if (tickRate_ <= 0.0f) tickRate_ = 60.0f;
+    return true;
+}
+
+int HeadlessRunner::run() {
+    if (!loadScript()) {
+        return -1;
+    }
+
+    // Systems log every spawn and hit; keep that out of the timing unless asked for
+    QuietLog quiet(!verbose_);
+
+    Simulation simulation;
+    bool initialized = simulation.initialize(mapId_);
+    if (!initialized || simulation.getTotalWaves() == 0) {
+        quiet.restore();
+        std::cerr << "[Headless] ERROR: Game data failed to load (run from the repo root?)" << std::endl;
+        return -1;
+    }
+
+    const float dt = 1.0f / tickRate_;
+    auto start = std::chrono::steady_clock::now();
+    SimulationScript::Result played = script_.play(simulation, dt, maxTicks_);
+    auto end = std::chrono::steady_clock::now();
+
+    quiet.restore();
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    uint64_t ticks = simulation.getTickCount();
+    double ticksPerSecond = seconds > 0.0 ? ticks / seconds : 0.0;
+
+    const char* outcome = simulation.isVictory() ? "VICTORY"
+                        : simulation.isDefeat() ? "DEFEAT"
+                        : "TICK LIMIT";
+
+    std::cout << "[Headless] Map: " << mapId_ << ", script: " << scriptPath_ << std::endl;
+    std::cout << "[Headless] Outcome: " << outcome
+              << " (wave " << simulation.getCurrentWave() << "/" << simulation.getTotalWaves()
+              << ", lives " << simulation.getLives() << ", gold " << simulation.getGold() << ")" << std::endl;
+    std::cout << "[Headless] Towers placed: " << played.placed << ", rejected: " << played.rejected << std::endl;
+    ProjectileSystem::PoolStats pool = simulation.getProjectileSystem()->getPoolStats();
+    std::cout << "[Headless] Projectiles: high water " << pool.highWater << ", dropped " << pool.dropped
+              << ", pages " << pool.pages << " x " << pool.pageSize << std::endl;
+    std::cout << std::fixed << std::setprecision(1)
+              << "[Headless] " << ticks << " ticks (" << (ticks * dt) << "s game time) in "
+              << std::setprecision(3) << seconds << "s wall" << std::endl;
+    std::cout << std::setprecision(0) << "[Headless] " << ticksPerSecond << " ticks/second ("
+              << (ticksPerSecond * dt) << "x real time)" << std::endl;
+
+    return simulation.isDefeat() ? 1 : 0;
+}
@@ -0,0 +1,29 @@
+#pragma once
+#include <string>
+#include "../core/SimulationScript.hpp"
+
+// Plays the configured waves on a Simulation with no window, placing towers
+// from a script, as fast as the CPU allows. Prints ticks/second at the end.
+//
+// Script (JSON):
+//   { "map": "forest_path", "tick_rate": 60, "max_ticks": 200000,
+//     "placements": [ { "before_wave": 1, "tower": "arrow_tower", "x": 224, "y": 128 } ] }
+// "before_wave" is 1-based; placements run right before that wave starts
+// (see SimulationScript).
+class HeadlessRunner {
+public:
+    HeadlessRunner(const std::string& scriptPath = "data/headless.json", bool verbose = false);
+    int run();
+    void setTickRate(float tickRate) { tickRateOverride_ = tickRate; }  // overrides the script's tick_rate
+
+private:
+    bool loadScript();
+
+    std::string scriptPath_;
+    bool verbose_;
+    std::string mapId_;
+    float tickRate_;
+    float tickRateOverride_ = 0.0f;
+    long long maxTicks_;
+    SimulationScript script_;
+};
@@ -0,0 +1,612 @@
+#include "../core/Simulation.hpp"
+#include "../systems/PathfindingSystem.hpp"
+#include "../systems/PathRequestQueue.hpp"
+#include "../systems/PathRegistry.hpp"
+#include "../systems/FlowField.hpp"
+#include "../systems/Grid.hpp"
+#include "../systems/ProjectileSystem.hpp"
+#include "../systems/EnemySystem.hpp"
+#include "../systems/TowerSystem.hpp"
+#include "../systems/UnitSystem.hpp"
+#include "../systems/CollisionSystem.hpp"
+#include "../systems/WaveSystem.hpp"
+#include "../systems/UpgradeSystem.hpp"
+#include "../systems/SaveLoadSystem.hpp"
+#include "../core/EventBus.hpp"
+#include "../core/GameEvents.hpp"
+#include "../entities/Enemy.hpp"
+#include "../entities/Unit.hpp"
+#include "../entities/Tower.hpp"
+#include "../components/Transform.hpp"
+#include "../components/Health.hpp"
+#include "../maps/Map.hpp"
+#include "../json/JSONLoader.hpp"
+#include <iostream>
+#include <cmath>
+
+Simulation::Simulation()
+    : gold_(500), lives_(20), currentWave_(0), nextWaveTimer_(0.0f),
+      waveInProgress_(false), victory_(false), tickCount_(0) {
+    pathfindingSystem_ = std::make_unique<PathfindingSystem>();
+    pathRequests_ = std::make_unique<PathRequestQueue>();
+    pathRegistry_ = std::make_unique<PathRegistry>();
+    flowField_ = std::make_unique<FlowField>();
+    projectileSystem_ = std::make_unique<ProjectileSystem>();
+    enemySystem_ = std::make_unique<EnemySystem>();
+    towerSystem_ = std::make_unique<TowerSystem>();
+    unitSystem_ = std::make_unique<UnitSystem>();
+    collisionSystem_ = std::make_unique<CollisionSystem>();
+    waveSystem_ = std::make_unique<WaveSystem>();
+    eventBus_ = std::make_unique<EventBus>();
+    map_ = std::make_unique<Map>();
+    enemySystem_->setEventBus(eventBus_.get());
+}
+
+Simulation::~Simulation() = default;
+
+bool Simulation::initialize(const std::string& mapId) {
+    JSONLoader jsonLoader;
+    bool dataLoaded = jsonLoader.loadAllGameData();
+    if (!dataLoaded) {
+        std::cerr << "[Simulation] WARNING: Some game data failed to load" << std::endl;
+    }
+
+    enemySystem_->initialize(projectileSystem_.get(), unitSystem_.get());
+    towerSystem_->initialize(enemySystem_.get(), projectileSystem_.get());
+    towerSystem_->setTargetingPolicies(jsonLoader.getAllTowerTargeting());
+    towerSystem_->setProjectileSpecs(jsonLoader.getAllTowerProjectiles());
+    unitSystem_->initialize(enemySystem_.get(), projectileSystem_.get());
+    unitSystem_->setProjectileSpecs(jsonLoader.getAllUnitProjectiles());
+    projectileSystem_->initialize(enemySystem_.get(), particleSystem_);
+    projectileSystem_->setCollisionSystem(collisionSystem_.get());
+    collisionSystem_->initialize(enemySystem_.get(), projectileSystem_.get());
+    waveSystem_->load(jsonLoader.getAllWaves());
+    waveSystem_->setSpawnCallback([this](const std::string& enemyId) {
+        spawnEnemy(enemyId);
+    });
+
+    mapId_ = mapId;
+    if (!map_->loadFromJSON(&jsonLoader, mapId)) {
+        std::cerr << "[Simulation] Map load failed, using default" << std::endl;
+        map_->loadDefault();
+    }
+
+    buildNavigation();
+    setupEventSubscriptions();
+    createInitialTowers();
+    return dataLoaded;
+}
+
+// Walkability grid sized to the map; on flow-field maps the field is rooted
+// at the map's end point and enemies steer by it
+void Simulation::buildNavigation() {
+    pathfindingSystem_->initialize(map_->cols(), map_->rows(), map_->tileSize());
+    Grid* grid = pathfindingSystem_->getGrid();
+    pathRequests_->setGrid(grid);
+    for (int y = 0; y < map_->rows(); ++y) {
+        for (int x = 0; x < map_->cols(); ++x) {
+            grid->setWalkable(x, y, map_->isWalkable(x, y));
+        }
+    }
+    for (const auto& tower : towerSystem_->getTowers()) {
+        setTowerCellBlocked(tower->transform->position, true);
+    }
+    // Built here, with the map, so no later search stalls on it
+    pathfindingSystem_->buildHierarchy();
+
+    if (map_->routing() == Map::Routing::FLOW_FIELD) {
+        flowField_->build(*grid, map_->getEndPoint());
+        enemySystem_->setFlowField(flowField_.get());
+        enemyRoute_ = pathRegistry_->intern({ map_->getSpawnPoint(), map_->getEndPoint() });
+    } else {
+        enemySystem_->setFlowField(nullptr);
+        enemyRoute_ = pathRegistry_->intern(map_->getPath());
+    }
+}
+
+void Simulation::setTowerCellBlocked(const sf::Vector2f& position, bool blocked) {
+    Grid* grid = pathfindingSystem_->getGrid();
+    sf::Vector2i cell = grid->worldToGrid(position);
+    grid->setWalkable(cell.x, cell.y, !blocked && map_->isWalkable(cell.x, cell.y));
+}
+
+// Every enemy, and the spawn, still has a way to the goal
+bool Simulation::routeStaysOpen() const {
+    if (!flowField_->isReachable(map_->getSpawnPoint())) return false;
+    for (const auto& enemy : enemySystem_->getEnemies()) {
+        if (enemy->health->alive() && !flowField_->isReachable(enemy->transform->position)) return false;
+    }
+    return true;
+}
+
+const FlowField* Simulation::getFlowField() const {
+    return map_->routing() == Map::Routing::FLOW_FIELD ? flowField_.get() : nullptr;
+}
+
+void Simulation::setParticleSystem(ParticleSystem* particleSystem) {
+    particleSystem_ = particleSystem;
+    projectileSystem_->initialize(enemySystem_.get(), particleSystem_);
+}
+
+void Simulation::setupEventSubscriptions() {
+    eventBus_->subscribe(Events::ENEMY_DIED, [this](const std::string& topic, void* data) {
+        EnemyEventData* eventData = static_cast<EnemyEventData*>(data);
+        if (eventData) {
+            gold_ += eventData->goldReward;
+            std::cout << "[Simulation] Enemy died! Gold: +" << eventData->goldReward
+                      << " (Total: " << gold_ << ")" << std::endl;
+        }
+    });
+
+    eventBus_->subscribe(Events::ENEMY_REACHED_END, [this](const std::string& topic, void* data) {
+        lives_--;
+        std::cout << "[Simulation] Enemy reached end! Lives remaining: " << lives_ << std::endl;
+
+        if (lives_ == 0) {
+            std::cout << "[Simulation] ✗✗✗ GAME OVER ✗✗✗" << std::endl;
+            eventBus_->publish(Events::GAME_DEFEAT, nullptr);
+        }
+    });
+}
+
+void Simulation::step(float dt) {
+    // Presentation interpolates from here to the end of this tick
+    enemySystem_->getStore().view<Transform>().each([](Transform& transform) {
+        transform.previousPosition = transform.position;
+    });
+    unitSystem_->getStore().view<Transform>().each([](Transform& transform) {
+        transform.previousPosition = transform.position;
+    });
+    // Paths searched since last tick; callers switch over now
+    pathRequests_->deliver();
+    if (map_->routing() == Map::Routing::FLOW_FIELD) {
+        flowField_->rebuildIfStale(*pathfindingSystem_->getGrid());
+    }
+    updateEntities(dt);
+    updateWaves(dt);
+    tickCount_++;
+}
+
+void Simulation::updateEntities(float dt) {
+    for (const auto& enemy : enemySystem_->getEnemies()) {
+        enemy->update(dt);
+    }
+    enemySystem_->update(dt);
+
+    // Enemies may have been removed above; clear those targets before anyone reads them
+    unitSystem_->refreshTargets();
+    for (const auto& unit : unitSystem_->getUnits()) {
+        unit->update(dt);
+    }
+    unitSystem_->update(dt);
+
+    towerSystem_->refreshTargets();
+    for (const auto& tower : towerSystem_->getTowers()) {
+        tower->update(dt);
+    }
+    towerSystem_->update(dt);
+
+    projectileSystem_->update(dt);
+
+    // One broadphase pass over enemies, units and projectiles; hits are read back from it
+    collisionSystem_->update(dt);
+    projectileSystem_->resolveContacts();
+}
+
+void Simulation::updateWaves(float dt) {
+    if (nextWaveTimer_ > 0.0f) {
+        nextWaveTimer_ -= dt;
+        if (nextWaveTimer_ < 0.0f) nextWaveTimer_ = 0.0f;
+    }
+
+    if (!waveInProgress_) {
+        return;
+    }
+
+    if (waveSystem_->isActive()) {
+        waveSystem_->update(dt);
+
+        if (waveSystem_->isFinished() && enemySystem_->getAliveCount() == 0) {
+            std::cout << "[Simulation] ========================================" << std::endl;
+            std::cout << "[Simulation] WAVE " << (currentWave_ + 1) << " COMPLETED!" << std::endl;
+            std::cout << "[Simulation] ========================================" << std::endl;
+
+            waveInProgress_ = false;
+
+            int reward = 50 + (currentWave_ * 25);
+            gold_ += reward;
+            std::cout << "[Simulation] Reward: " << reward << " gold (Total: " << gold_ << ")" << std::endl;
+
+            WaveEventData data;
+            data.waveNumber = currentWave_ + 1;
+            data.goldReward = reward;
+            eventBus_->publish(Events::WAVE_COMPLETED, &data);
+
+            currentWave_++;
+
+            if (currentWave_ >= waveSystem_->getTotalWaves()) {
+                std::cout << "[Simulation] ✓✓✓ ALL WAVES COMPLETED - VICTORY! ✓✓✓" << std::endl;
+                victory_ = true;
+                eventBus_->publish(Events::ALL_WAVES_COMPLETED, nullptr);
+            } else {
+                nextWaveTimer_ = 5.0f;
+                std::cout << "[Simulation] Next wave ready in " << nextWaveTimer_ << " seconds" << std::endl;
+            }
+        }
+    }
+}
+
+int Simulation::getTotalWaves() const {
+    return waveSystem_->getTotalWaves();
+}
+
+bool Simulation::canStartNextWave() const {
+    return !waveInProgress_ && nextWaveTimer_ <= 0.0f && currentWave_ < waveSystem_->getTotalWaves();
+}
+
+bool Simulation::startNextWave() {
+    if (currentWave_ < waveSystem_->getTotalWaves() && !waveInProgress_) {
+        waveSystem_->start(currentWave_);
+        waveInProgress_ = true;
+        nextWaveTimer_ = 0.0f;
+        std::cout << "[Simulation] ========================================" << std::endl;
+        std::cout << "[Simulation] Starting wave " << (currentWave_ + 1) << " of " << waveSystem_->getTotalWaves() << std::endl;
+        std::cout << "[Simulation] ========================================" << std::endl;
+        return true;
+    }
+    return false;
+}
+
+void Simulation::createInitialTowers() {
+    // Create UNIQUE main base tower
+    mainBaseTower_ = towerSystem_->create();
+    mainBaseTower_->initializeAsType("arrow_tower");
+    mainBaseTower_->transform->position = sf::Vector2f(150, 350);
+    mainBaseTower_->sprite->visible = true;
+    mainBaseTower_->sprite->textureId = "MAIN_BASE";
+    towerSystem_->add(mainBaseTower_);
+    setTowerCellBlocked(mainBaseTower_->transform->position, true);
+
+    std::cout << "[Simulation] Created MAIN BASE tower at (150, 350)" << std::endl;
+}
+
+void Simulation::spawnEnemy(const std::string& enemyId) {
+    auto enemy = enemySystem_->create();
+    enemy->initializeAsType(enemyId);
+
+    // Every enemy shares the map's route; spawning copies a handle, not the waypoints
+    enemy->path->setRoute(enemyRoute_);
+    enemy->path->followField = map_->routing() == Map::Routing::FLOW_FIELD;
+
+    if (enemy->path->hasPath()) {
+        enemy->transform->position = enemy->path->getStart();
+    }
+
+    enemySystem_->add(enemy);
+
+    // Presentation hooks textures up from here
+    EnemyEventData data;
+    data.enemy = enemy->handle;
+    data.position = enemy->transform->position;
+    data.enemyType = enemyId;
+    data.goldReward = 0;
+    eventBus_->publish(Events::ENEMY_SPAWNED, &data);
+}
+
+void Simulation::clearEntities() {
+    pathRequests_->cancelAll();
+    towerSystem_->clear();
+    unitSystem_->clear();
+    projectileSystem_->clear();
+
+    for (const auto& enemy : enemySystem_->getEnemies()) {
+        if (enemy && enemy->health) {
+            enemy->health->hp = 0;
+        }
+    }
+    enemySystem_->removeDead();
+}
+
+void Simulation::restart() {
+    clearEntities();
+
+    gold_ = 500;
+    lives_ = 20;
+    currentWave_ = 0;
+    nextWaveTimer_ = 0.0f;
+    waveInProgress_ = false;
+    victory_ = false;
+    tickCount_ = 0;
+
+    buildNavigation();
+    createInitialTowers();
+}
+
+bool Simulation::isValidTowerPosition(const sf::Vector2f& position) const {
+    float mapWidth = map_->cols() * map_->tileSize();
+    float mapHeight = map_->rows() * map_->tileSize();
+
+    if (position.x < 0 || position.x > mapWidth ||
+        position.y < 0 || position.y > mapHeight) {
+        return false;
+    }
+
+    bool buildable = map_->isValidBuildPosition(position);
+    if (!buildable) {
+        return false;
+    }
+
+    for (const auto& tower : towerSystem_->getTowers()) {
+        float dx = position.x - tower->transform->position.x;
+        float dy = position.y - tower->transform->position.y;
+        float distance = std::sqrt(dx * dx + dy * dy);
+        if (distance < 60.0f) {
+            return false;
+        }
+    }
+
+    float minPathDistance = 999999.0f;
+    for (const auto& pathPoint : map_->getPath()) {
+        float dx = position.x - pathPoint.x;
+        float dy = position.y - pathPoint.y;
+        float distance = std::sqrt(dx * dx + dy * dy);
+        if (distance < minPathDistance) {
+            minPathDistance = distance;
+        }
+    }
+
+    if (minPathDistance < 20.0f) {
+        return false;
+    }
+
+    return true;
+}
+
+bool Simulation::isValidUnitPosition(const sf::Vector2f& position) const {
+    float mapWidth = map_->cols() * map_->tileSize();
+    float mapHeight = map_->rows() * map_->tileSize();
+
+    // Must be within map bounds
+    if (position.x < 0 || position.x > mapWidth ||
+        position.y < 0 || position.y > mapHeight) {
+        return false;
+    }
+
+    // Cannot be on path (must be on buildable ground)
+    bool buildable = map_->isValidBuildPosition(position);
+    if (!buildable) {
+        return false;
+    }
+
+    // Cannot be too close to towers
+    for (const auto& tower : towerSystem_->getTowers()) {
+        float dx = position.x - tower->transform->position.x;
+        float dy = position.y - tower->transform->position.y;
+        float distance = std::sqrt(dx * dx + dy * dy);
+        if (distance < 50.0f) {
+            return false;
+        }
+    }
+
+    // Cannot be too close to other units
+    for (const auto& unit : unitSystem_->getUnits()) {
+        float dx = position.x - unit->transform->position.x;
+        float dy = position.y - unit->transform->position.y;
+        float distance = std::sqrt(dx * dx + dy * dy);
+        if (distance < 30.0f) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+std::shared_ptr<Tower> Simulation::placeTower(const std::string& towerType, const sf::Vector2f& position) {
+    if (!isValidTowerPosition(position)) {
+        return nullptr;
+    }
+
+    int cost = getTowerCost(towerType);
+
+    if (gold_ < cost) {
+        std::cout << "[Simulation] Not enough gold. Need: " << cost << ", Have: " << gold_ << std::endl;
+        return nullptr;
+    }
+
+    if (!towerSystem_->canPlaceTower(position)) {
+        return nullptr;
+    }
+
+    // On open maps a tower is a wall; refuse one that would seal the goal off
+    if (map_->routing() == Map::Routing::FLOW_FIELD) {
+        setTowerCellBlocked(position, true);
+        flowField_->rebuildIfStale(*pathfindingSystem_->getGrid());
+        if (!routeStaysOpen()) {
+            setTowerCellBlocked(position, false);
+            flowField_->rebuildIfStale(*pathfindingSystem_->getGrid());
+            std::cout << "[Simulation] Tower would block the enemy route" << std::endl;
+            return nullptr;
+        }
+    }
+
+    auto tower = towerSystem_->create();
+    tower->initializeAsType(towerType);
+    tower->transform->position = position;
+    towerSystem_->add(tower);
+    setTowerCellBlocked(position, true);
+
+    // CRITICAL FIX: Deduct gold AFTER adding tower
+    gold_ -= cost;
+    std::cout << "[Simulation] ✓ TOWER PLACED - Deducted " << cost << " gold. Remaining: " << gold_ << std::endl;
+
+    TowerEventData data;
+    data.tower = tower->handle;
+    data.position = position;
+    data.towerType = towerType;
+    data.cost = cost;
+    eventBus_->publish(Events::TOWER_PLACED, &data);
+
+    return tower;
+}
+
+std::shared_ptr<Unit> Simulation::placeUnit(const std::string& unitType, const sf::Vector2f& position) {
+    if (!isValidUnitPosition(position)) {
+        return nullptr;
+    }
+
+    int cost = getUnitCost(unitType);
+
+    if (gold_ < cost) {
+        std::cout << "[Simulation] Not enough gold. Need: " << cost << ", Have: " << gold_ << std::endl;
+        return nullptr;
+    }
+
+    auto unit = unitSystem_->create();
+    unit->initializeAsType(unitType);
+    unit->transform->position = position;
+    unitSystem_->add(unit);
+
+    // CRITICAL FIX: Deduct gold AFTER adding unit
+    gold_ -= cost;
+    std::cout << "[Simulation] ✓ UNIT PLACED - Deducted " << cost << " gold. Remaining: " << gold_ << std::endl;
+
+    return unit;
+}
+
+int Simulation::sellTower(EntityHandle handle) {
+    const auto& tower = towerSystem_->find(handle);
+    if (!tower || isMainBase(tower)) return -1;
+
+    int refund = getTowerSellValue(tower);
+    gold_ += refund;
+    setTowerCellBlocked(tower->transform->position, false);
+    towerSystem_->remove(handle);
+    return refund;
+}
+
+bool Simulation::upgradeTower(EntityHandle handle) {
+    const auto& tower = towerSystem_->find(handle);
+    return tower && UpgradeSystem::upgradeTower(tower, gold_);
+}
+
+bool Simulation::upgradeUnit(EntityHandle handle) {
+    const auto& unit = unitSystem_->find(handle);
+    return unit && UpgradeSystem::upgradeUnit(unit, gold_);
+}
+
+bool Simulation::isMainBase(const std::shared_ptr<Tower>& tower) const {
+    return tower == mainBaseTower_ || (tower && tower->sprite->textureId == "MAIN_BASE");
+}
+
+std::shared_ptr<Tower> Simulation::getTowerAtPosition(const sf::Vector2f& worldPos) const {
+    for (const auto& tower : towerSystem_->getTowers()) {
+        sf::Vector2f diff = tower->transform->position - worldPos;
+        float distanceSq = diff.x * diff.x + diff.y * diff.y;
+        float radiusSq = 50.0f * 50.0f;
+
+        if (distanceSq <= radiusSq) {
+            return tower;
+        }
+    }
+    return nullptr;
+}
+
+std::shared_ptr<Unit> Simulation::getUnitAtPosition(const sf::Vector2f& worldPos) const {
+    for (const auto& unit : unitSystem_->getUnits()) {
+        if (!unit->health->alive()) continue;
+
+        sf::Vector2f diff = unit->transform->position - worldPos;
+        float distanceSq = diff.x * diff.x + diff.y * diff.y;
+        float radiusSq = 30.0f * 30.0f;
+
+        if (distanceSq <= radiusSq) {
+            return unit;
+        }
+    }
+    return nullptr;
+}
+
+int Simulation::getTowerCost(const std::string& towerType) const {
+    if (towerType == "arrow_tower") return 100;
+    if (towerType == "cannon_tower") return 200;
+    if (towerType == "mage_tower") return 300;
+    if (towerType == "ice_tower") return 250;
+    if (towerType == "lightning_tower") return 400;
+    if (towerType == "poison_tower") return 350;
+    if (towerType == "ballista") return 450;
+    if (towerType == "flame_tower") return 500;
+    if (towerType == "tesla_tower") return 600;
+    if (towerType == "arcane_tower") return 800;
+    if (towerType == "sniper_tower") return 700;
+    if (towerType == "artillery_tower") return 1000;
+    return 100;
+}
+
+int Simulation::getUnitCost(const std::string& unitType) const {
+    if (unitType == "archer") return 80;
+    if (unitType == "knight") return 120;
+    if (unitType == "mage") return 150;
+    if (unitType == "rogue") return 100;
+    if (unitType == "paladin") return 180;
+    if (unitType == "ranger") return 130;
+    if (unitType == "berserker") return 160;
+    if (unitType == "priest") return 140;
+    if (unitType == "necromancer") return 170;
+    if (unitType == "druid") return 190;
+    if (unitType == "engineer") return 210;
+    if (unitType == "monk") return 220;
+    return 80;
+}
+
+int Simulation::getTowerSellValue(const std::shared_ptr<Tower>& tower) const {
+    int baseCost = getTowerCost(tower->towerType);
+
+    int upgradeCosts = 0;
+    if (tower->upgrade && tower->upgrade->level > 1) {
+        for (int i = 1; i < tower->upgrade->level; i++) {
+            upgradeCosts += baseCost * (i + 1);
+        }
+    }
+
+    return static_cast<int>((baseCost + upgradeCosts) * 0.75f);
+}
+
+bool Simulation::save(const std::string& filename) const {
+    GameSaveData saveData;
+    saveData.gold = gold_;
+    saveData.lives = lives_;
+    saveData.currentWave = currentWave_;
+    saveData.score = 0;
+    saveData.nextWaveTimer = nextWaveTimer_;
+    saveData.waveInProgress = waveInProgress_;
+    saveData.currentMap = mapId_;
+
+    return SaveLoadSystem::saveGame(filename, saveData, towerSystem_->getTowers(), unitSystem_->getUnits());
+}
+
+bool Simulation::load(const std::string& filename) {
+    GameSaveData saveData;
+    std::vector<std::shared_ptr<Tower>> towers;
+    std::vector<std::shared_ptr<Unit>> units;
+
+    if (!SaveLoadSystem::loadGame(filename, saveData, towers, units)) {
+        return false;
+    }
+
+    gold_ = saveData.gold;
+    lives_ = saveData.lives;
+    currentWave_ = saveData.currentWave;
+    nextWaveTimer_ = saveData.nextWaveTimer;
+    waveInProgress_ = saveData.waveInProgress;
+    victory_ = false;
+
+    clearEntities();
+    for (const auto& tower : towers) {
+        towerSystem_->add(tower);
+    }
+    buildNavigation();
+    for (const auto& unit : units) {
+        unitSystem_->add(unit);
+    }
+    return true;
+}
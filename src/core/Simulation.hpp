@@ -0,0 +1,129 @@
+#pragma once
+#include <memory>
+#include <string>
+#include <cstdint>
+#include <SFML/System/Vector2.hpp>
+#include "../core/EntityHandle.hpp"
+
+// Forward declarations
+class PathfindingSystem;
+class PathRequestQueue;
+class PathRegistry;
+struct PathRoute;
+class FlowField;
+class ProjectileSystem;
+class EnemySystem;
+class TowerSystem;
+class UnitSystem;
+class CollisionSystem;
+class ParticleSystem;
+class WaveSystem;
+class EventBus;
+class Map;
+class Tower;
+class Unit;
+
+// Window-free game state: owns the gameplay systems, gold, lives and wave
+// progress, and advances them with step(dt). Game presents it; the headless
+// runner drives it directly.
+class Simulation {
+public:
+    Simulation();
+    ~Simulation();
+    // Loads game data and the map, wires the systems and builds the main base
+    bool initialize(const std::string& mapId = "forest_path");
+    void step(float dt);
+    void restart();
+
+    // Waves
+    bool canStartNextWave() const;
+    bool startNextWave();
+
+    // Player actions. Placement returns nullptr if the spot is invalid or unaffordable.
+    std::shared_ptr<Tower> placeTower(const std::string& towerType, const sf::Vector2f& position);
+    std::shared_ptr<Unit> placeUnit(const std::string& unitType, const sf::Vector2f& position);
+    int sellTower(EntityHandle handle);  // refund, or -1 if it can't be sold
+    bool upgradeTower(EntityHandle handle);
+    bool upgradeUnit(EntityHandle handle);
+    bool save(const std::string& filename) const;
+    bool load(const std::string& filename);
+
+    // Queries
+    bool isValidTowerPosition(const sf::Vector2f& position) const;
+    bool isValidUnitPosition(const sf::Vector2f& position) const;
+    int getTowerCost(const std::string& towerType) const;
+    int getUnitCost(const std::string& unitType) const;
+    int getTowerSellValue(const std::shared_ptr<Tower>& tower) const;
+    std::shared_ptr<Tower> getTowerAtPosition(const sf::Vector2f& worldPos) const;
+    std::shared_ptr<Unit> getUnitAtPosition(const sf::Vector2f& worldPos) const;
+    bool isMainBase(const std::shared_ptr<Tower>& tower) const;
+
+    int getGold() const { return gold_; }
+    int getLives() const { return lives_; }
+    int getCurrentWave() const { return currentWave_; }
+    int getTotalWaves() const;
+    float getNextWaveTimer() const { return nextWaveTimer_; }
+    bool isWaveInProgress() const { return waveInProgress_; }
+    bool isVictory() const { return victory_; }
+    bool isDefeat() const { return lives_ <= 0; }
+    bool isOver() const { return victory_ || lives_ <= 0; }
+    uint64_t getTickCount() const { return tickCount_; }
+
+    // Systems, for presentation
+    EnemySystem* getEnemySystem() { return enemySystem_.get(); }
+    TowerSystem* getTowerSystem() { return towerSystem_.get(); }
+    UnitSystem* getUnitSystem() { return unitSystem_.get(); }
+    ProjectileSystem* getProjectileSystem() { return projectileSystem_.get(); }
+    WaveSystem* getWaveSystem() { return waveSystem_.get(); }
+    EventBus* getEventBus() { return eventBus_.get(); }
+    Map* getMap() { return map_.get(); }
+    // Off-thread path searches on snapshots of the navigation grid; results
+    // are delivered at the start of step(). Nothing in the game requests
+    // paths yet (enemies follow their route or the flow field, units hold
+    // position); this is the entry point for code that will.
+    PathRequestQueue* getPathRequests() { return pathRequests_.get(); }
+    // Interned routes; enemies reference these instead of copying waypoints
+    PathRegistry* getPathRegistry() { return pathRegistry_.get(); }
+    // Built only on flow-field maps, null otherwise
+    const FlowField* getFlowField() const;
+    // Projectile trails and impacts; optional, nothing is emitted without
+    // one. Purely visual: damage, splash included, is the same either way.
+    void setParticleSystem(ParticleSystem* particleSystem);
+
+private:
+    void updateEntities(float dt);
+    void updateWaves(float dt);
+    void spawnEnemy(const std::string& enemyId);
+    void createInitialTowers();
+    void clearEntities();
+    void setupEventSubscriptions();
+    void buildNavigation();
+    void setTowerCellBlocked(const sf::Vector2f& position, bool blocked);
+    bool routeStaysOpen() const;
+
+    std::unique_ptr<PathfindingSystem> pathfindingSystem_;
+    std::unique_ptr<PathRequestQueue> pathRequests_;
+    std::unique_ptr<PathRegistry> pathRegistry_;
+    std::shared_ptr<const PathRoute> enemyRoute_;  // what spawnEnemy hands out
+    std::unique_ptr<FlowField> flowField_;
+    std::unique_ptr<ProjectileSystem> projectileSystem_;
+    std::unique_ptr<EnemySystem> enemySystem_;
+    std::unique_ptr<TowerSystem> towerSystem_;
+    std::unique_ptr<UnitSystem> unitSystem_;
+    std::unique_ptr<CollisionSystem> collisionSystem_;
+    std::unique_ptr<WaveSystem> waveSystem_;
+    std::unique_ptr<EventBus> eventBus_;
+    std::unique_ptr<Map> map_;
+    ParticleSystem* particleSystem_ = nullptr;
+
+    // Game state variables
+    int gold_;
+    int lives_;
+    int currentWave_;
+    float nextWaveTimer_;
+    bool waveInProgress_;
+    bool victory_;
+    uint64_t tickCount_;
+    std::string mapId_;
+    std::shared_ptr<Tower> mainBaseTower_;
+};
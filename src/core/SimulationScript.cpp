@@ -0,0 +1,36 @@
+#include "../core/SimulationScript.hpp"
+#include "../core/Simulation.hpp"
+
+void SimulationScript::loadPlacements(const nlohmann::json& placements) {
+    placements_.clear();
+    if (!placements.is_array()) return;
+    for (const auto& entry : placements) {
+        Placement placement;
+        placement.beforeWave = entry.value("before_wave", 1);
+        placement.towerType = entry.value("tower", std::string("arrow_tower"));
+        placement.position = sf::Vector2f(entry.value("x", 0.0f), entry.value("y", 0.0f));
+        placements_.push_back(placement);
+    }
+}
+
+SimulationScript::Result SimulationScript::play(Simulation& simulation, float dt, long long maxTicks,
+                                                int waveLimit) const {
+    Result result;
+    while (!simulation.isOver() && static_cast<long long>(simulation.getTickCount()) < maxTicks) {
+        if (simulation.canStartNextWave()) {
+            if (waveLimit > 0 && simulation.getCurrentWave() >= waveLimit) break;
+            int wave = simulation.getCurrentWave() + 1;
+            for (const auto& placement : placements_) {
+                if (placement.beforeWave != wave) continue;
+                if (simulation.placeTower(placement.towerType, placement.position)) {
+                    result.placed++;
+                } else {
+                    result.rejected++;
+                }
+            }
+            simulation.startNextWave();
+        }
+        simulation.step(dt);
+    }
+    return result;
+}
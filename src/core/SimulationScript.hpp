@@ -0,0 +1,38 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <SFML/System/Vector2.hpp>
+#include "../json/json.hpp"
+class Simulation;
+
+// Plays a Simulation with no window: before each wave starts, places the
+// towers scripted for it, then starts the wave as soon as it may, stepping
+// at a fixed dt. HeadlessRunner and BalanceRunner both drive their games
+// through this, so a script plays the same under either.
+//
+// Placements (JSON array):
+//   [ { "before_wave": 1, "tower": "arrow_tower", "x": 224, "y": 128 } ]
+// "before_wave" is 1-based.
+class SimulationScript {
+public:
+    struct Placement {
+        int beforeWave;
+        std::string towerType;
+        sf::Vector2f position;
+    };
+    struct Result {
+        int placed = 0;
+        int rejected = 0;  // placeTower refused (cost, position, blocked route)
+    };
+
+    // Replaces the placements; anything but an array leaves none. Throws
+    // nlohmann::json exceptions for malformed entries.
+    void loadPlacements(const nlohmann::json& placements);
+    const std::vector<Placement>& getPlacements() const { return placements_; }
+    // Plays until the game is over, maxTicks have run, or waveLimit waves
+    // (0 = every wave) are done and the next could start
+    Result play(Simulation& simulation, float dt, long long maxTicks, int waveLimit = 0) const;
+
+private:
+    std::vector<Placement> placements_;
+};
@@ -1,8 +1,51 @@
 #pragma once
+#include <SFML/System/Vector2.hpp>
 class TimeStep {
 public:
     TimeStep(float dt = 0.f) : dt_(dt) {}
     float delta() const { return dt_; }
 private:
     float dt_;
-};
\ No newline at end of file
+};
+
+// Accumulator for a fixed simulation tick. Feed it real frame time with
+// advance(); it returns how many ticks of delta() to run. Backlog beyond
+// maxSubsteps ticks is dropped so a slow frame can't snowball. alpha() is how
+// far real time sits between the last two ticks, for interpolated rendering.
+class FixedTimeStep {
+public:
+    explicit FixedTimeStep(float tickRate = 60.f, int maxSubsteps = 5)
+        : step_(1.f / tickRate), maxSubsteps_(maxSubsteps), accumulator_(0.f) {}
+
+    void setTickRate(float tickRate) {
+        if (tickRate > 0.f) step_ = 1.f / tickRate;
+        accumulator_ = 0.f;
+    }
+    void setMaxSubsteps(int maxSubsteps) { maxSubsteps_ = maxSubsteps > 0 ? maxSubsteps : 1; }
+
+    int advance(float frameTime) {
+        accumulator_ += frameTime;
+        int ticks = static_cast<int>(accumulator_ / step_);
+        if (ticks > maxSubsteps_) {
+            ticks = maxSubsteps_;
+            accumulator_ = 0.f;
+        } else {
+            accumulator_ -= ticks * step_;
+        }
+        return ticks;
+    }
+    void reset() { accumulator_ = 0.f; }
+
+    float delta() const { return step_; }
+    float tickRate() const { return 1.f / step_; }
+    float alpha() const { return accumulator_ / step_; }
+
+private:
+    float step_;
+    int maxSubsteps_;
+    float accumulator_;
+};
+
+inline sf::Vector2f interpolate(const sf::Vector2f& previous, const sf::Vector2f& current, float alpha) {
+    return previous + (current - previous) * alpha;
+}
@@ -1,8 +1,34 @@
 #include "../core/Application.hpp"
+#include "../core/HeadlessRunner.hpp"
 #include <iostream>
 #include <exception>
+#include <string>
+#include <cstdlib>
 
-int main() {
+int main(int argc, char* argv[]) {
+    // --headless [script.json] [--verbose]: play the scripted waves without a window
+    // --tick-rate <hz>: fixed simulation rate (default 60)
+    bool headless = false;
+    bool verbose = false;
+    float tickRate = 0.0f;
+    std::string script = "data/headless.json";
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--headless") {
+            headless = true;
+            if (i + 1 < argc && argv[i + 1][0] != '-') script = argv[++i];
+        } else if (arg == "--verbose") {
+            verbose = true;
+        } else if (arg == "--tick-rate" && i + 1 < argc) {
+            tickRate = std::strtof(argv[++i], nullptr);
+        }
+    }
+    if (headless) {
+        HeadlessRunner runner(script, verbose);
+        if (tickRate > 0.0f) runner.setTickRate(tickRate);
+        return runner.run();
+    }
+    
     std::cout << "=====================================" << std::endl;
     std::cout << "    TOWER DEFENSE GAME" << std::endl;
     std::cout << "=====================================" << std::endl;
@@ -10,6 +36,7 @@ int main() {
     try {
         // Create application instance
         Application app("Tower Defense Game");
+        if (tickRate > 0.0f) app.setTickRate(tickRate);
         
         // Initialize the application
         std::cout << "\n[Main] Initializing application..." << std::endl;
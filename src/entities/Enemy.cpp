@@ -17,6 +17,29 @@ Enemy::Enemy() {
     enemyType = "goblin";
 }
 
+Enemy::Enemy(EnemyStore& store) {
+    attachTo(store);
+    
+    velocity = sf::Vector2f(0, 0);
+    acceleration = sf::Vector2f(0, 0);
+    enemyType = "goblin";
+}
+
+void Enemy::attachTo(EnemyStore& store) {
+    if (store.owns(storage)) return;
+    auto slot = store.acquire();
+    store.adopt(slot, transform);
+    store.adopt(slot, sprite);
+    store.adopt(slot, anim);
+    store.adopt(slot, health);
+    store.adopt(slot, stats);
+    store.adopt(slot, path);
+    store.adopt(slot, collider);
+    store.adopt(slot, effects);
+    store.adopt(slot, ai);
+    storage = slot;
+}
+
 void Enemy::initialize() {
     health->hp = 100;
     health->maxHp = 100;
@@ -143,8 +166,7 @@ void Enemy::initializeAsType(const std::string& type) {
     path->speed = ai->pathSpeed;
     path->arrivalThreshold = 10.0f;  // Increased from 5.0f to prevent getting stuck
     path->loop = false;
-    path->finished = false;
-    path->currentIndex = 0;
+    path->reset();
     
     std::cout << "[Enemy] Initialized " << type << " - HP: " << health->hp << ", Speed: " << ai->pathSpeed << std::endl;
 }
@@ -192,14 +214,19 @@ void Enemy::update(float dt) {
 }
 
 void Enemy::updateMovement(float dt) {
+    // Flow-field movers are steered by EnemySystem alone
+    if (path->followField) {
+        isMoving = !path->finished;
+        return;
+    }
     if (path->hasPath() && !path->finished) {
         sf::Vector2f target = path->getCurrentTarget();
         sf::Vector2f direction = target - transform->position;
         float distance = std::sqrt(direction.x * direction.x + direction.y * direction.y);
         
         if (distance < path->arrivalThreshold) {
-            path->currentIndex++;
-            if (path->currentIndex >= path->path.size()) {
+            path->advance();
+            if (!path->hasPath()) {
                 path->finished = true;
                 velocity = sf::Vector2f(0, 0);
             }
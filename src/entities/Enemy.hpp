@@ -12,6 +12,8 @@
 #include "../components/ColliderComp.hpp"
 #include "../components/StatusEffectsComp.hpp"
 #include "../components/EnemyAI.hpp"
+#include "../core/Archetypes.hpp"
+#include "../core/EntityHandle.hpp"
 class Enemy {
 public:
     std::shared_ptr<Transform> transform;
@@ -33,9 +35,15 @@ public:
     float attackTimer = 0.0f;
     // PHASE 3: Enemy type for different behaviors
     std::string enemyType;
+    // Slot in an EnemySystem's component store; empty while components live on the heap
+    EnemyStore::Lease storage;
+    // Assigned by the owning system on add(); stale once the enemy is removed
+    EntityHandle handle;
     Enemy();
+    explicit Enemy(EnemyStore& store);
     ~Enemy() = default;
     void initialize();
+    void attachTo(EnemyStore& store);
     void initializeAsType(const std::string& type);
     void update(float dt);
 private:
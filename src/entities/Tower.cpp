@@ -10,6 +10,21 @@ Tower::Tower() {
     stats = std::make_shared<StatsComp>();      
     towerType = "arrow_tower";
 }
+Tower::Tower(TowerStore& store) {
+    attachTo(store);
+    towerType = "arrow_tower";
+}
+void Tower::attachTo(TowerStore& store) {
+    if (store.owns(storage)) return;
+    auto slot = store.acquire();
+    store.adopt(slot, transform);
+    store.adopt(slot, sprite);
+    store.adopt(slot, anim);
+    store.adopt(slot, ai);
+    store.adopt(slot, upgrade);
+    store.adopt(slot, stats);
+    storage = slot;
+}
 void Tower::initialize() {
     ai->cooldown = 1.0f;
     upgrade->level = 1;
@@ -149,7 +164,8 @@ void Tower::update(float dt) {
     }
 }
 void Tower::updateCombat(float dt) {
-    if (ai->currentTarget && ai->currentTarget->health->alive() && ai->cooldown <= 0) {
+    // TowerSystem::refreshTargets clears targets that died or were removed
+    if (ai->currentTarget && ai->cooldown <= 0) {
         isAttacking = true;
         attackTimer = 0.4f; // Attack animation duration
         ai->cooldown = 1.0f / stats->attackSpeed;
@@ -7,6 +7,8 @@
 #include "../components/TowerAI.hpp"
 #include "../components/UpgradeComp.hpp"
 #include "../components/Stats.hpp"
+#include "../core/Archetypes.hpp"
+#include "../core/EntityHandle.hpp"
 class Tower {
 public:
     std::shared_ptr<Transform> transform;
@@ -21,8 +23,14 @@ public:
     float attackTimer = 0.0f;
     float buildTimer = 0.0f;
     std::string towerType;
+    // Slot in a TowerSystem's component store; empty while components live on the heap
+    TowerStore::Lease storage;
+    // Assigned by the owning system on add(); stale once the tower is removed
+    EntityHandle handle;
     Tower();
+    explicit Tower(TowerStore& store);
     void initialize();
+    void attachTo(TowerStore& store);
     void initializeAsType(const std::string& type);
     void update(float dt);
 private:
@@ -19,6 +19,29 @@ Unit::Unit() {
     unitType = "archer";
 }
 
+Unit::Unit(UnitStore& store) {
+    attachTo(store);
+    
+    velocity = sf::Vector2f(0, 0);
+    acceleration = sf::Vector2f(0, 0);
+    unitType = "archer";
+}
+
+void Unit::attachTo(UnitStore& store) {
+    if (store.owns(storage)) return;
+    auto slot = store.acquire();
+    store.adopt(slot, transform);
+    store.adopt(slot, sprite);
+    store.adopt(slot, anim);
+    store.adopt(slot, health);
+    store.adopt(slot, stats);
+    store.adopt(slot, collider);
+    store.adopt(slot, ai);
+    store.adopt(slot, selectable);
+    store.adopt(slot, upgrade);
+    storage = slot;
+}
+
 void Unit::initialize() {
     health->hp = 50;
     health->maxHp = 50;
@@ -102,8 +125,9 @@ void Unit::update(float dt) {
 
 void Unit::updateMovement(float dt) {
     // Simple movement towards target if we have one
-    if (ai->currentTarget && ai->currentTarget->health->alive()) {
-        sf::Vector2f targetPos = ai->currentTarget->transform->position;
+    // UnitSystem::refreshTargets clears dead targets and caches their position
+    if (ai->currentTarget) {
+        sf::Vector2f targetPos = ai->targetPosition;
         sf::Vector2f direction = targetPos - transform->position;
         float distance = std::sqrt(direction.x * direction.x + direction.y * direction.y);
         
@@ -134,8 +158,8 @@ void Unit::updateMovement(float dt) {
     }
 }
 void Unit::updateCombat(float dt) {
-    if (ai->currentTarget && ai->currentTarget->health->alive() && ai->cooldown <= 0) {
-        sf::Vector2f targetPos = ai->currentTarget->transform->position;
+    if (ai->currentTarget && ai->cooldown <= 0) {
+        sf::Vector2f targetPos = ai->targetPosition;
         sf::Vector2f direction = targetPos - transform->position;
         float distance = std::sqrt(direction.x * direction.x + direction.y * direction.y);
         if (distance <= ai->attackRange) {
@@ -11,6 +11,8 @@
 #include "../components/UnitAI.hpp"
 #include "../components/SelectableComp.hpp"
 #include "../components/UpgradeComp.hpp"
+#include "../core/Archetypes.hpp"
+#include "../core/EntityHandle.hpp"
 class Unit {
 public:
     std::shared_ptr<Transform> transform;
@@ -31,9 +33,15 @@ public:
     float deathTimer = 0.0f;
     float attackTimer = 0.0f;
     std::string unitType;
+    // Slot in a UnitSystem's component store; empty while components live on the heap
+    UnitStore::Lease storage;
+    // Assigned by the owning system on add(); stale once the unit is removed
+    EntityHandle handle;
     Unit();
+    explicit Unit(UnitStore& store);
     ~Unit() = default;
     void initialize();
+    void attachTo(UnitStore& store);
     void initializeAsType(const std::string& type);
     void update(float dt);
 private:
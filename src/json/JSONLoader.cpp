@@ -125,6 +125,10 @@ bool JSONLoader::parseUnitData(const json& data) {
             stats.attackRange = unitData["attack_range"];
             stats.attackSpeed = unitData["attack_speed"];
             units_[id] = stats;
+            ProjectileSpec projectile;
+            if (parseProjectile(unitData, projectile)) {
+                unitProjectiles_[id] = projectile;
+            }
             count++;       
             std::cout << "[JSONLoader] Loaded unit: " << id 
                       << " (damage: " << stats.damage << ", range: " << stats.attackRange << ")" << std::endl;
@@ -136,6 +140,13 @@ bool JSONLoader::parseUnitData(const json& data) {
     std::cout << "[JSONLoader] Successfully loaded " << count << " units" << std::endl;
     return count > 0;
 }
+// "projectile_texture" and optional "projectile_speed"; false if the entry has no projectile
+bool JSONLoader::parseProjectile(const json& data, ProjectileSpec& out) {
+    if (!data.contains("projectile_texture")) return false;
+    out.texture = data["projectile_texture"];
+    out.speed = data.value("projectile_speed", 0.0f);
+    return true;
+}
 bool JSONLoader::parseTowerData(const json& data) {
     int count = 0;
     for (const auto& towerData : data) {
@@ -147,6 +158,19 @@ bool JSONLoader::parseTowerData(const json& data) {
             stats.attackSpeed = towerData["attack_speed"];
             // Note: towers don't have speed in your JSON
             towers_[id] = stats;
+            if (towerData.contains("targeting")) {
+                std::string targeting = towerData["targeting"];
+                TowerAI::Targeting policy;
+                if (TowerAI::parseTargeting(targeting, policy)) {
+                    towerTargeting_[id] = policy;
+                } else {
+                    std::cerr << "[JSONLoader] Unknown targeting '" << targeting << "' for tower " << id << std::endl;
+                }
+            }
+            ProjectileSpec projectile;
+            if (parseProjectile(towerData, projectile)) {
+                towerProjectiles_[id] = projectile;
+            }
             count++;       
             std::cout << "[JSONLoader] Loaded tower: " << id 
                       << " (damage: " << stats.damage << ", range: " << stats.attackRange << ")" << std::endl;
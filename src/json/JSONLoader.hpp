@@ -3,6 +3,8 @@
 #include <unordered_map>
 #include <vector>
 #include "../components/Stats.hpp"
+#include "../components/TowerAI.hpp"
+#include "../components/ProjectileArchetype.hpp"
 #include "../json/types.hpp"
 #include "../json/json.hpp"  
 #include "../systems/AnimationSystem.hpp"
@@ -34,12 +36,18 @@ public:
     const std::unordered_map<std::string, StatsComp>& getAllEnemyStats() const { return enemies_; }
     const std::unordered_map<std::string, StatsComp>& getAllUnitStats() const { return units_; }
     const std::unordered_map<std::string, StatsComp>& getAllTowerStats() const { return towers_; }
+    const std::unordered_map<std::string, TowerAI::Targeting>& getAllTowerTargeting() const { return towerTargeting_; }
+    const std::unordered_map<std::string, ProjectileSpec>& getAllTowerProjectiles() const { return towerProjectiles_; }
+    const std::unordered_map<std::string, ProjectileSpec>& getAllUnitProjectiles() const { return unitProjectiles_; }
     const std::vector<Wave>& getAllWaves() const { return waves_; }
     
 private:
     std::unordered_map<std::string, StatsComp> enemies_;
     std::unordered_map<std::string, StatsComp> units_;
     std::unordered_map<std::string, StatsComp> towers_;
+    std::unordered_map<std::string, TowerAI::Targeting> towerTargeting_;
+    std::unordered_map<std::string, ProjectileSpec> towerProjectiles_;
+    std::unordered_map<std::string, ProjectileSpec> unitProjectiles_;
     std::unordered_map<std::string, std::vector<Animation>> atlases_;
     std::unordered_map<int, std::vector<Wave>> levelWaves_;
     std::vector<Wave> waves_;
@@ -50,4 +58,5 @@ private:
     bool parseTowerData(const json& data);
     bool parseMapData(const json& data);
     bool parseWaveData(const json& data);
+    static bool parseProjectile(const json& data, ProjectileSpec& out);
 };
\ No newline at end of file
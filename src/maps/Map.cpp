@@ -74,8 +74,12 @@ bool Map::parseMapData(const json& mapData) {
         
         std::cout << "[Map] Size: " << cols_ << "x" << rows_ << ", tile size: " << tile_ << std::endl;
         
-        // Initialize grid as BLOCKED (0) - buildable for towers
-        grid_.resize(cols_ * rows_, 0);
+        std::string routing = mapData.value("routing", std::string("waypoints"));
+        routing_ = routing == "flow_field" ? Routing::FLOW_FIELD : Routing::WAYPOINTS;
+        std::cout << "[Map] Routing: " << routing << std::endl;
+        
+        // Initialize grid as BLOCKED - buildable for towers
+        tiles_ = Grid(cols_, rows_, tile_, false);
         
         // Mark PATH tiles as walkable (1) - NOT buildable
         // Calculate path bounds and mark as walkable
@@ -90,7 +94,7 @@ bool Map::parseMapData(const json& mapData) {
                         int x = pathX + dx;
                         int y = pathY + dy;
                         if (x >= 0 && x < cols_ && y >= 0 && y < rows_) {
-                            grid_[y * cols_ + x] = 1; // 1 = walkable (path)
+                            tiles_.setWalkable(x, y, true); // walkable (path)
                         }
                     }
                 }
@@ -105,7 +109,7 @@ bool Map::parseMapData(const json& mapData) {
                     int x = tile[0];
                     int y = tile[1];
                     if (x >= 0 && x < cols_ && y >= 0 && y < rows_) {
-                        grid_[y * cols_ + x] = 0; // 0 = blocked = buildable
+                        tiles_.setWalkable(x, y, false); // blocked = buildable
                         blockedCount++;
                     }
                 }
@@ -132,9 +136,11 @@ bool Map::parseMapData(const json& mapData) {
         // Count buildable vs path tiles
         int buildableCount = 0;
         int pathCount = 0;
-        for (const auto& tile : grid_) {
-            if (tile == 0) buildableCount++;
-            else pathCount++;
+        for (int y = 0; y < rows_; ++y) {
+            for (int x = 0; x < cols_; ++x) {
+                if (tiles_.isWalkable(x, y)) pathCount++;
+                else buildableCount++;
+            }
         }
         std::cout << "[Map] Grid: " << buildableCount << " buildable tiles, " << pathCount << " path tiles" << std::endl;
         
@@ -152,9 +158,10 @@ bool Map::loadDefault() {
     cols_ = 20;
     rows_ = 15;
     tile_ = 32.0f;
+    routing_ = Routing::WAYPOINTS;
     
     // Initialize as blocked (buildable)
-    grid_.resize(cols_ * rows_, 0);
+    tiles_ = Grid(cols_, rows_, tile_, false);
     
     // Simple default path
     path_.clear();
@@ -170,7 +177,7 @@ bool Map::loadDefault() {
                 int x = point.x + dx;
                 int y = point.y + dy;
                 if (x >= 0 && x < cols_ && y >= 0 && y < rows_) {
-                    grid_[y * cols_ + x] = 1; // 1 = walkable (path)
+                    tiles_.setWalkable(x, y, true); // walkable (path)
                 }
             }
         }
@@ -194,15 +201,20 @@ bool Map::isValidBuildPosition(const sf::Vector2f& worldPos) const {
         return false;
     }
     
-    // Check if tile is BLOCKED (0 = blocked = buildable for towers)
+    // Check if tile is BLOCKED (blocked = buildable for towers)
     // Towers can ONLY be placed on blocked tiles, NOT on walkable path tiles
-    int index = gridY * cols_ + gridX;
-    if (index >= static_cast<int>(grid_.size())) {
+    return !tiles_.isWalkable(gridX, gridY);
+}
+
+bool Map::isWalkable(int x, int y) const {
+    if (x < 0 || x >= cols_ || y < 0 || y >= rows_) {
         return false;
     }
-    
-    // Return true if BLOCKED (0 = buildable), false if walkable (1 = path)
-    return grid_[index] == 0;
+    // Open maps are walkable everywhere; towers carve the route at runtime
+    if (routing_ == Routing::FLOW_FIELD) {
+        return true;
+    }
+    return tiles_.isWalkable(x, y);
 }
 
 sf::Vector2f Map::getSpawnPoint() const {
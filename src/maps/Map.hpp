@@ -4,19 +4,28 @@
 #include <SFML/System/Vector2.hpp>
 #include <cstdint>
 #include "../json/json.hpp"
+#include "../systems/Grid.hpp"
 
 class JSONLoader;
 using json = nlohmann::json;
 
 class Map {
 public:
+    // How enemies get from spawn to goal: along the "path" waypoints, or by a
+    // shared flow field over an open, walkable map ("routing": "flow_field")
+    enum class Routing { WAYPOINTS, FLOW_FIELD };
+
     bool loadFromJSON(JSONLoader* jsonLoader, const std::string& mapId);
     bool loadDefault();
     const std::vector<sf::Vector2f>& getPath() const { return path_; }
     int cols() const { return cols_; }
     int rows() const { return rows_; }
     float tileSize() const { return tile_; }
-    const std::vector<uint8_t>& grid() const { return grid_; }
+    // Path tiles as walkable cells; everything else is buildable
+    const Grid& grid() const { return tiles_; }
+    Routing routing() const { return routing_; }
+    // Whether enemies may walk this cell, before any towers are placed
+    bool isWalkable(int x, int y) const;
     
     // Helper methods for validation
     bool isValidBuildPosition(const sf::Vector2f& worldPos) const;
@@ -27,9 +36,10 @@ public:
 private:
     bool parseMapData(const json& mapData);
     std::vector<sf::Vector2f> path_;
-    std::vector<uint8_t> grid_;
+    Grid tiles_;
     int cols_ = 0;
     int rows_ = 0;
     float tile_ = 32.f;
+    Routing routing_ = Routing::WAYPOINTS;
     std::string mapId_;
 };
\ No newline at end of file
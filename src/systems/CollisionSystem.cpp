@@ -1,32 +1,61 @@
 #include "../systems/CollisionSystem.hpp"
+#include "../systems/EnemySystem.hpp"
+#include "../systems/ProjectileSystem.hpp"
+#include "../entities/Enemy.hpp"
+#include "../components/Transform.hpp"
+#include "../components/Health.hpp"
+#include <algorithm>
 #include <cmath>
-// FIX PARAMETER TYPE
-void CollisionSystem::submit(const ColliderComp& c) {
-    list_.push_back(c);
+void CollisionSystem::initialize(EnemySystem* enemySystem, ProjectileSystem* projectileSystem) {
+    enemySystem_ = enemySystem;
+    projectileSystem_ = projectileSystem;
 }
-std::vector<std::pair<int, int>> CollisionSystem::detect() {
-    std::vector<std::pair<int, int>> collisions;
-    for (size_t i = 0; i < list_.size(); ++i) {
-        for (size_t j = i + 1; j < list_.size(); ++j) {
-            const ColliderComp& a = list_[i];  // FIXED: Use ColliderComp
-            const ColliderComp& b = list_[j];  // FIXED: Use ColliderComp
-            // You'll need to access position differently since ColliderComp doesn't have pos
-            // This needs to be coordinated with your entity system
-            float dx = 0, dy = 0; // Placeholder - you need entity positions
-            float distanceSq = dx * dx + dy * dy;
-            float minDistance = a.radius + b.radius;       
-            if (distanceSq < minDistance * minDistance) {
-                collisions.emplace_back(i, j); // Use indices since no id field
+void CollisionSystem::submit(const sf::Vector2f& position, const ColliderComp& c, uint32_t layer, uint32_t mask, EntityHandle owner) {
+    proxies_.push_back({position, c.radius, layer, mask, owner});
+}
+void CollisionSystem::submit(const CollisionProxy& proxy) {
+    proxies_.push_back(proxy);
+}
+const std::vector<Contact>& CollisionSystem::detect() {
+    contacts_.clear();
+    sweep_.clear();
+    for (size_t i = 0; i < proxies_.size(); ++i) {
+        const CollisionProxy& p = proxies_[i];
+        sweep_.push_back({p.position.x - p.radius, p.position.x + p.radius, static_cast<uint32_t>(i)});
+    }
+    std::sort(sweep_.begin(), sweep_.end(),
+        [](const SweepEntry& l, const SweepEntry& r) { return l.minX < r.minX; });
+    // Only entries whose x-interval starts before this one ends can overlap it
+    for (size_t i = 0; i < sweep_.size(); ++i) {
+        const CollisionProxy& a = proxies_[sweep_[i].proxy];
+        for (size_t j = i + 1; j < sweep_.size() && sweep_[j].minX <= sweep_[i].maxX; ++j) {
+            const CollisionProxy& b = proxies_[sweep_[j].proxy];
+            if (!(a.mask & b.layer) && !(b.mask & a.layer)) continue;
+            float dx = a.position.x - b.position.x;
+            float dy = a.position.y - b.position.y;
+            float minDistance = a.radius + b.radius;
+            if (dx * dx + dy * dy < minDistance * minDistance) {
+                contacts_.push_back({sweep_[i].proxy, sweep_[j].proxy});
             }
         }
-    }   
-    return collisions;
+    }
+    return contacts_;
 }
 void CollisionSystem::clear() {
-    list_.clear();
+    proxies_.clear();
+    contacts_.clear();
 }
 void CollisionSystem::update(float dt) {
-    auto collisions = detect();
-    // Handle collisions
     clear();
-}
\ No newline at end of file
+    if (enemySystem_) {
+        for (const auto& enemy : enemySystem_->getEnemies()) {
+            if (!enemy->health->alive()) continue;
+            submit(enemy->transform->position, *enemy->collider, CollisionLayer::ENEMY,
+                   CollisionLayer::PROJECTILE, enemy->handle);
+        }
+    }
+    if (projectileSystem_) {
+        projectileSystem_->submitColliders(*this);
+    }
+    detect();
+}
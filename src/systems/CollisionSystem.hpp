@@ -1,12 +1,71 @@
 #pragma once
 #include "../components/ColliderComp.hpp"  // This includes the Collider struct
+#include "../core/EntityHandle.hpp"
+#include <SFML/System/Vector2.hpp>
 #include <vector>
+#include <cstdint>
+// Forward declarations
+class EnemySystem;
+class ProjectileSystem;
+namespace CollisionLayer {
+    const uint32_t NONE = 0;
+    const uint32_t ENEMY = 1u << 0;
+    const uint32_t UNIT = 1u << 1;
+    const uint32_t TOWER = 1u << 2;
+    const uint32_t PROJECTILE = 1u << 3;
+}
+// A collider placed in the world for this tick. Two proxies are tested only
+// if either one's mask includes the other's layer.
+struct CollisionProxy {
+    sf::Vector2f position;
+    float radius;
+    uint32_t layer;
+    uint32_t mask;
+    EntityHandle owner;  // handle into whichever system submitted it
+};
+struct Contact {
+    uint32_t a;  // proxy indices
+    uint32_t b;
+};
+// Sort-and-sweep broadphase on x with a circle narrowphase. update() gathers
+// enemies and projectiles and runs one pass; ProjectileSystem reads the
+// contacts back instead of scanning enemies. Units melee by range query and
+// are left out until something consumes their contacts.
 class CollisionSystem {
 private:
-    std::vector<ColliderComp> list_;  // FIXED: Use ColliderComp, not Collider
+    struct SweepEntry {
+        float minX;
+        float maxX;
+        uint32_t proxy;
+    };
+    std::vector<CollisionProxy> proxies_;
+    std::vector<SweepEntry> sweep_;     // reused between ticks
+    std::vector<Contact> contacts_;     // reused between ticks
+    EnemySystem* enemySystem_ = nullptr;
+    ProjectileSystem* projectileSystem_ = nullptr;
 public:
-    void submit(const ColliderComp& c);  // FIXED: Use ColliderComp
-    std::vector<std::pair<int, int>> detect();
+    void initialize(EnemySystem* enemySystem, ProjectileSystem* projectileSystem);
+    void submit(const sf::Vector2f& position, const ColliderComp& c, uint32_t layer, uint32_t mask, EntityHandle owner);
+    void submit(const CollisionProxy& proxy);
+    const std::vector<Contact>& detect();
     void clear();
     void update(float dt);
-};
\ No newline at end of file
+    const std::vector<CollisionProxy>& getProxies() const { return proxies_; }
+    const std::vector<Contact>& getContacts() const { return contacts_; }
+    // fn(a, b) for every contact between layerA and layerB, with a on layerA
+    template<typename Fn>
+    void forEachContact(uint32_t layerA, uint32_t layerB, Fn&& fn) const;
+};
+
+template<typename Fn>
+void CollisionSystem::forEachContact(uint32_t layerA, uint32_t layerB, Fn&& fn) const {
+    for (const Contact& contact : contacts_) {
+        const CollisionProxy& a = proxies_[contact.a];
+        const CollisionProxy& b = proxies_[contact.b];
+        if ((a.layer & layerA) && (b.layer & layerB)) {
+            fn(a, b);
+        } else if ((b.layer & layerA) && (a.layer & layerB)) {
+            fn(b, a);
+        }
+    }
+}
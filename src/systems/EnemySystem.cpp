@@ -11,6 +11,7 @@
 #include "../components/Transform.hpp"
 #include "../components/ColliderComp.hpp"
 #include "../components/AnimationStateComp.hpp"
+#include "../systems/FlowField.hpp"
 #include <algorithm>
 #include <cmath>
 #include <iostream>
@@ -31,8 +32,20 @@ void EnemySystem::setEventBus(EventBus* eventBus) {
     std::cout << "[EnemySystem] EventBus connected" << std::endl;
 }
 
+std::shared_ptr<Enemy> EnemySystem::create() {
+    return std::make_shared<Enemy>(store_);
+}
+
 void EnemySystem::add(std::shared_ptr<Enemy> enemy) {
-    enemies_.push_back(enemy);
+    // Enemies built with make_shared<Enemy>() move their components into the store here
+    enemy->attachTo(store_);
+    store_.setActive(enemy->storage, true);
+    enemy->transform->previousPosition = enemy->transform->position;
+    // Visible to queries right away; bucketed on the next rebuild
+    enemy->path->progress = progressOf(*enemy->path, enemy->transform->position);
+    spatialIndex_.insert(static_cast<int>(enemies_.size()), enemy->transform->position, enemy->path->progress);
+    maxColliderRadius_ = std::max(maxColliderRadius_, enemy->collider->radius);
+    enemy->handle = enemies_.insert(enemy);
     aliveCount_++;
     std::cout << "[EnemySystem] Added enemy. Total alive: " << aliveCount_ << std::endl;
 }
@@ -42,59 +55,97 @@ void EnemySystem::update(float dt) {
     updateCombat(dt);
     checkEnemyEndReached();
     removeDead();
+    updateProgress();
+    rebuildSpatialIndex();
+}
+
+void EnemySystem::updateProgress() {
+    store_.view<PathFollower, Transform>().each([this](PathFollower& path, Transform& transform) {
+        path.progress = progressOf(path, transform.position);
+    });
+}
+
+float EnemySystem::progressOf(const PathFollower& path, const sf::Vector2f& position) const {
+    if (path.followField && flowField_) return flowField_->progressAt(position);
+    return path.progressAt(position);
 }
 
 void EnemySystem::updateMovement(float dt) {
-    for (auto& enemy : enemies_) {
-        if (!enemy->health->alive()) continue;
+    const FlowField* field = flowField_;
+    store_.view<PathFollower, Transform, HealthComp, EnemyAI>().each(
+        [dt, field](PathFollower& path, Transform& transform, HealthComp& health, EnemyAI& ai) {
+        if (!health.alive()) return;
         
-        if (enemy->path->hasPath() && !enemy->path->finished) {
-            sf::Vector2f target = enemy->path->getCurrentTarget();
-            sf::Vector2f direction = target - enemy->transform->position;
+        if (path.followField && field && !path.finished) {
+            // One lookup per tick; the goal cell steers straight at the goal point
+            sf::Vector2f direction = field->directionAt(transform.position);
+            if (field->isGoalCell(transform.position)) {
+                sf::Vector2f toGoal = field->getGoal() - transform.position;
+                float distance = std::sqrt(toGoal.x * toGoal.x + toGoal.y * toGoal.y);
+                if (distance < path.arrivalThreshold) {
+                    path.finished = true;
+                    return;
+                }
+                direction = toGoal / distance;
+            }
+            transform.position += direction * ai.pathSpeed * dt;
+        } else if (path.hasPath() && !path.finished) {
+            sf::Vector2f target = path.getCurrentTarget();
+            sf::Vector2f direction = target - transform.position;
             float distance = std::sqrt(direction.x * direction.x + direction.y * direction.y);
             
-            if (distance < enemy->path->arrivalThreshold) {
-                enemy->path->currentIndex++;
-                if (enemy->path->currentIndex >= enemy->path->path.size()) {
-                    enemy->path->finished = true;
-                    std::cout << "[EnemySystem] ⚠ Enemy reached end of path!" << std::endl;
-                    
-                    // PUBLISH EVENT THROUGH EVENTBUS
-                    if (eventBus_) {
-                        std::cout << "[EnemySystem] Publishing ENEMY_REACHED_END event" << std::endl;
-                        eventBus_->publish(Events::ENEMY_REACHED_END, nullptr);
-                    }
-                    
-                    // Also call the callback for backward compatibility
-                    if (onEnemyReachedEnd_) {
-                        onEnemyReachedEnd_(enemy);
-                    }
+            if (distance < path.arrivalThreshold) {
+                path.advance();
+                if (!path.hasPath()) {
+                    // Events need the owning Enemy; checkEnemyEndReached publishes them
+                    path.finished = true;
                 }
             } else {
                 if (distance > 0.1f) {
                     direction /= distance;
-                    enemy->transform->position += direction * enemy->ai->pathSpeed * dt;
+                    transform.position += direction * ai.pathSpeed * dt;
                 }
             }
         }
-    }
+    });
 }
 
 void EnemySystem::updateCombat(float dt) {
-    for (auto& enemy : enemies_) {
-        if (!enemy->health->alive()) continue;
+    store_.view<HealthComp, EnemyAI>().each([dt](HealthComp& health, EnemyAI& ai) {
+        if (!health.alive()) return;
         
-        if (enemy->ai->attackRange > 0 && enemy->ai->cooldown <= 0) {
-            enemy->ai->cooldown = enemy->ai->attackCooldown;
+        if (ai.attackRange > 0 && ai.cooldown <= 0) {
+            ai.cooldown = ai.attackCooldown;
         }
         
-        if (enemy->ai->cooldown > 0) enemy->ai->cooldown -= dt;
-    }
+        if (ai.cooldown > 0) ai.cooldown -= dt;
+    });
 }
 
 void EnemySystem::checkEnemyEndReached() {
-    for (auto& enemy : enemies_) {
+    // Cheap linear pass first; Enemy::update can also finish a path, so this
+    // covers both movers
+    bool anyFinished = false;
+    store_.view<PathFollower, HealthComp>().each([&anyFinished](PathFollower& path, HealthComp& health) {
+        if (path.finished && health.alive()) anyFinished = true;
+    });
+    if (!anyFinished) return;
+    
+    for (auto& enemy : enemies_.values()) {
         if (enemy->path->finished && enemy->health->alive()) {
+            std::cout << "[EnemySystem] ⚠ Enemy reached end of path!" << std::endl;
+            
+            // PUBLISH EVENT THROUGH EVENTBUS
+            if (eventBus_) {
+                std::cout << "[EnemySystem] Publishing ENEMY_REACHED_END event" << std::endl;
+                eventBus_->publish(Events::ENEMY_REACHED_END, nullptr);
+            }
+            
+            // Also call the callback for backward compatibility
+            if (onEnemyReachedEnd_) {
+                onEnemyReachedEnd_(enemy);
+            }
+            
             std::cout << "[EnemySystem] Enemy at end - marking as dead" << std::endl;
             enemy->health->hp = 0;
         }
@@ -103,72 +154,132 @@ void EnemySystem::checkEnemyEndReached() {
 
 void EnemySystem::removeDead() {
     int removedCount = 0;
-    enemies_.erase(std::remove_if(enemies_.begin(), enemies_.end(),
-        [this, &removedCount](const std::shared_ptr<Enemy>& enemy) {
-            if (!enemy->health->alive()) {
-                std::cout << "[EnemySystem] Removing dead enemy" << std::endl;
-                
-                // Check if enemy died from reaching end vs being killed
-                bool reachedEnd = enemy->path && enemy->path->finished;
-                
-                if (!reachedEnd) {
-                    // Enemy was killed, give gold reward
-                    int goldReward = 10 + (enemy->health->maxHp / 10);
-                    
-                    // PUBLISH ENEMY_DIED EVENT
-                    if (eventBus_) {
-                        EnemyEventData data;
-                        data.enemy = enemy;
-                        data.goldReward = goldReward;
-                        eventBus_->publish(Events::ENEMY_DIED, &data);
-                    }
-                    
-                    // Also call callback for backward compatibility
-                    if (onEnemyDied_) {
-                        onEnemyDied_(enemy);
-                    }
-                }
-                
-                aliveCount_--;
-                removedCount++;
-                return true;
+    auto& enemies = enemies_.values();
+    for (size_t i = 0; i < enemies.size();) {
+        std::shared_ptr<Enemy> enemy = enemies[i];
+        if (enemy->health->alive()) {
+            ++i;
+            continue;
+        }
+        std::cout << "[EnemySystem] Removing dead enemy" << std::endl;
+        
+        // Check if enemy died from reaching end vs being killed
+        bool reachedEnd = enemy->path && enemy->path->finished;
+        
+        if (!reachedEnd) {
+            // Enemy was killed, give gold reward
+            int goldReward = 10 + (enemy->health->maxHp / 10);
+            
+            // PUBLISH ENEMY_DIED EVENT
+            if (eventBus_) {
+                EnemyEventData data;
+                data.enemy = enemy->handle;
+                data.position = enemy->transform->position;
+                data.enemyType = enemy->enemyType;
+                data.goldReward = goldReward;
+                data.killedBy = enemy->ai->lastHitBy;
+                eventBus_->publish(Events::ENEMY_DIED, &data);
             }
-            return false;
-        }), enemies_.end());
+            
+            // Also call callback for backward compatibility
+            if (onEnemyDied_) {
+                onEnemyDied_(enemy);
+            }
+        }
+        
+        // Swap-removes; the last enemy moves into slot i, so don't advance.
+        // Every handle to this enemy goes stale here.
+        store_.setActive(enemy->storage, false);
+        enemies_.erase(enemy->handle);
+        aliveCount_--;
+        removedCount++;
+    }
     
     if (removedCount > 0) {
+        // Indices shifted; rebuild before the next query
+        spatialIndexDirty_ = true;
         std::cout << "[EnemySystem] Removed " << removedCount << " enemies. Alive: " << aliveCount_ << std::endl;
     }
 }
 
-std::shared_ptr<Enemy> EnemySystem::getEnemyAtPosition(const sf::Vector2f& position, float radius) {
-    for (auto& enemy : enemies_) {
+void EnemySystem::rebuildSpatialIndex() {
+    spatialIndex_.clear();
+    maxColliderRadius_ = 0.0f;
+    const auto& enemies = enemies_.values();
+    for (size_t i = 0; i < enemies.size(); ++i) {
+        const auto& enemy = enemies[i];
         if (!enemy->health->alive()) continue;
+        spatialIndex_.insert(static_cast<int>(i), enemy->transform->position, enemy->path->progress);
+        maxColliderRadius_ = std::max(maxColliderRadius_, enemy->collider->radius);
+    }
+    spatialIndex_.rebuild();
+    spatialIndexDirty_ = false;
+}
+
+const std::shared_ptr<Enemy>& EnemySystem::getEnemyAtPosition(const sf::Vector2f& position, float radius) {
+    if (spatialIndexDirty_) rebuildSpatialIndex();
+    
+    // Widen by the largest collider so every candidate lands in the scanned cells
+    int bestIndex = -1;
+    spatialIndex_.query(position, radius + maxColliderRadius_, [&](int index) {
+        const auto& enemy = enemies_.values()[index];
+        if (!enemy->health->alive()) return true;
         
         sf::Vector2f diff = enemy->transform->position - position;
         float distanceSq = diff.x * diff.x + diff.y * diff.y;
         float combinedRadius = enemy->collider->radius + radius;
         
-        if (distanceSq < combinedRadius * combinedRadius) return enemy;
-    }
-    return nullptr;
+        // Lowest index wins so the result matches the old linear scan
+        if (distanceSq < combinedRadius * combinedRadius && (bestIndex < 0 || index < bestIndex)) {
+            bestIndex = index;
+        }
+        return true;
+    });
+    return bestIndex >= 0 ? enemies_.values()[bestIndex] : noEnemy_;
 }
 
 std::vector<std::shared_ptr<Enemy>> EnemySystem::getEnemiesInRange(const sf::Vector2f& position, float range) {
     std::vector<std::shared_ptr<Enemy>> result;
-    float rangeSq = range * range;
-    
-    for (auto& enemy : enemies_) {
-        if (!enemy->health->alive()) continue;
-        
-        sf::Vector2f diff = enemy->transform->position - position;
-        float distanceSq = diff.x * diff.x + diff.y * diff.y;
-        
-        if (distanceSq <= rangeSq) result.push_back(enemy);
-    }
+    forEachEnemyInRange(position, range, [&](const std::shared_ptr<Enemy>& enemy) {
+        result.push_back(enemy);
+    });
     return result;
 }
 
+size_t EnemySystem::getEnemiesInRange(const sf::Vector2f& position, float range, Enemy** out, size_t capacity) {
+    size_t count = 0;
+    if (capacity == 0) return 0;
+    forEachEnemyInRange(position, range, [&](const std::shared_ptr<Enemy>& enemy) {
+        out[count++] = enemy.get();
+        return count < capacity;
+    });
+    return count;
+}
+
+const std::shared_ptr<Enemy>& EnemySystem::findFirstEnemyInRange(const sf::Vector2f& position, float range) {
+    return findFirstEnemyInRange(position, range, [](const std::shared_ptr<Enemy>&) { return true; });
+}
+
+void EnemySystem::visitEnemiesInRange(const sf::Vector2f& position, float range, EnemyVisitor visitor, void* context) {
+    if (spatialIndexDirty_) rebuildSpatialIndex();
+    
+    spatialIndex_.query(position, range, [&](int index) {
+        const auto& enemy = enemies_.values()[index];
+        if (!enemy->health->alive()) return true;
+        return visitor(context, enemy);
+    });
+}
+
+const std::shared_ptr<Enemy>& EnemySystem::findEnemyByProgress(const sf::Vector2f& position, float range, bool furthest) {
+    if (spatialIndexDirty_) rebuildSpatialIndex();
+    
+    const auto& enemies = enemies_.values();
+    int index = spatialIndex_.queryExtreme(position, range, furthest, [&enemies](int i) {
+        return enemies[i]->health->alive();
+    });
+    return index >= 0 ? enemies[index] : noEnemy_;
+}
+
 void EnemySystem::setOnEnemyDied(std::function<void(std::shared_ptr<Enemy>)> callback) {
     onEnemyDied_ = callback;
 }
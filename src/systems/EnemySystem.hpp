@@ -2,44 +2,132 @@
 #include <vector>
 #include <memory>
 #include <functional>
+#include <type_traits>
 #include <SFML/System/Vector2.hpp>
+#include "../utils/SpatialHash.hpp"
+#include "../core/Archetypes.hpp"
+#include "../core/EntityHandle.hpp"
+#include "../utils/SlotMap.hpp"
 
 // Forward declarations ONLY in headers
 class Enemy;
 class ProjectileSystem;
 class UnitSystem;
 class EventBus;  // ADD THIS
+class FlowField;
+struct PathFollower;
 
 class EnemySystem {
 public:
     EnemySystem();
     void initialize(ProjectileSystem* projectileSystem, UnitSystem* unitSystem);
     void setEventBus(EventBus* eventBus);  // ADD THIS
+    // Shared field for enemies whose PathFollower::followField is set; null on waypoint maps
+    void setFlowField(const FlowField* flowField) { flowField_ = flowField; }
+    // Creates an enemy whose components already live in this system's store
+    std::shared_ptr<Enemy> create();
     void add(std::shared_ptr<Enemy> enemy);
     void update(float dt);
     void removeDead();
-    std::shared_ptr<Enemy> getEnemyAtPosition(const sf::Vector2f& position, float radius);
+    const std::shared_ptr<Enemy>& getEnemyAtPosition(const sf::Vector2f& position, float radius);
     std::vector<std::shared_ptr<Enemy>> getEnemiesInRange(const sf::Vector2f& position, float range);
     
+    // Allocation-free queries. Visitors get a reference into the enemy list
+    // (no refcount copy) for every live enemy in range and may return false
+    // to stop early. References stay valid until the next removeDead().
+    template<typename Fn>
+    void forEachEnemyInRange(const sf::Vector2f& position, float range, Fn&& fn);
+    template<typename Pred>
+    const std::shared_ptr<Enemy>& findFirstEnemyInRange(const sf::Vector2f& position, float range, Pred&& pred);
+    const std::shared_ptr<Enemy>& findFirstEnemyInRange(const sf::Vector2f& position, float range);
+    // Lowest key(enemy) wins
+    template<typename Key>
+    const std::shared_ptr<Enemy>& findBestEnemyInRange(const sf::Vector2f& position, float range, Key&& key);
+    // Fills a caller-owned span, returns how many were written (at most capacity)
+    size_t getEnemiesInRange(const sf::Vector2f& position, float range, Enemy** out, size_t capacity);
+    // Live enemy in range that is furthest along its path (least far if !furthest).
+    // Uses the progress-ordered cell buckets, so most of the range is never visited.
+    const std::shared_ptr<Enemy>& findEnemyByProgress(const sf::Vector2f& position, float range, bool furthest);
+    
     // Keep these for backward compatibility
     void setOnEnemyDied(std::function<void(std::shared_ptr<Enemy>)> callback);
     void setOnEnemyReachedEnd(std::function<void(std::shared_ptr<Enemy>)> callback);
     
-    const std::vector<std::shared_ptr<Enemy>>& getEnemies() const { return enemies_; }
+    const std::vector<std::shared_ptr<Enemy>>& getEnemies() const { return enemies_.values(); }
+    // O(1); empty pointer if the handle is null or the enemy has been removed
+    const std::shared_ptr<Enemy>& find(EntityHandle handle) const {
+        const std::shared_ptr<Enemy>* enemy = enemies_.get(handle);
+        return enemy ? *enemy : noEnemy_;
+    }
     int getAliveCount() const { return aliveCount_; }
+    const SpatialHash& getSpatialIndex() const { return spatialIndex_; }
+    EnemyStore& getStore() { return store_; }
 
 private:
     void updateMovement(float dt);
     void updateCombat(float dt);
     void checkEnemyEndReached();
+    void updateProgress();
+    float progressOf(const PathFollower& path, const sf::Vector2f& position) const;
+    void rebuildSpatialIndex();
+    using EnemyVisitor = bool (*)(void* context, const std::shared_ptr<Enemy>& enemy);
+    void visitEnemiesInRange(const sf::Vector2f& position, float range, EnemyVisitor visitor, void* context);
     
-    std::vector<std::shared_ptr<Enemy>> enemies_;
+    SlotMap<std::shared_ptr<Enemy>> enemies_;
+    EnemyStore store_;
     ProjectileSystem* projectileSystem_;
     UnitSystem* unitSystem_;
     EventBus* eventBus_ = nullptr;  // ADD THIS
+    const FlowField* flowField_ = nullptr;
     
     std::function<void(std::shared_ptr<Enemy>)> onEnemyDied_;
     std::function<void(std::shared_ptr<Enemy>)> onEnemyReachedEnd_;
     
     int aliveCount_ = 0;
+    
+    // Cell buckets of dense indices into enemies_, keyed by path progress and
+    // rebuilt once per tick after movement
+    SpatialHash spatialIndex_;
+    float maxColliderRadius_ = 0.0f;
+    bool spatialIndexDirty_ = false;
+    const std::shared_ptr<Enemy> noEnemy_;
 };
+
+template<typename Fn>
+void EnemySystem::forEachEnemyInRange(const sf::Vector2f& position, float range, Fn&& fn) {
+    using Visitor = std::remove_reference_t<Fn>;
+    visitEnemiesInRange(position, range, [](void* context, const std::shared_ptr<Enemy>& enemy) {
+        Visitor& visit = *static_cast<Visitor*>(context);
+        if constexpr (std::is_void_v<decltype(visit(enemy))>) {
+            visit(enemy);
+            return true;
+        } else {
+            return static_cast<bool>(visit(enemy));
+        }
+    }, const_cast<void*>(static_cast<const void*>(&fn)));
+}
+
+template<typename Pred>
+const std::shared_ptr<Enemy>& EnemySystem::findFirstEnemyInRange(const sf::Vector2f& position, float range, Pred&& pred) {
+    const std::shared_ptr<Enemy>* found = &noEnemy_;
+    forEachEnemyInRange(position, range, [&](const std::shared_ptr<Enemy>& enemy) {
+        if (!pred(enemy)) return true;
+        found = &enemy;
+        return false;
+    });
+    return *found;
+}
+
+template<typename Key>
+const std::shared_ptr<Enemy>& EnemySystem::findBestEnemyInRange(const sf::Vector2f& position, float range, Key&& key) {
+    const std::shared_ptr<Enemy>* best = &noEnemy_;
+    float bestKey = 0.0f;
+    forEachEnemyInRange(position, range, [&](const std::shared_ptr<Enemy>& enemy) {
+        float value = static_cast<float>(key(enemy));
+        if (best == &noEnemy_ || value < bestKey) {
+            best = &enemy;
+            bestKey = value;
+        }
+    });
+    return *best;
+}
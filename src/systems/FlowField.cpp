@@ -0,0 +1,270 @@
+#include "../systems/FlowField.hpp"
+#include "../systems/Grid.hpp"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+
+namespace {
+const int kNeighborX[8] = { 1, -1, 0, 0, 1, 1, -1, -1 };
+const int kNeighborY[8] = { 0, 0, 1, -1, 1, -1, 1, -1 };
+const float kDiagonal = 1.41421356f;
+}
+
+FlowField::FlowField() : goal_(0.0f, 0.0f) {}
+
+float FlowField::unreachable() {
+    return std::numeric_limits<float>::infinity();
+}
+
+void FlowField::build(const Grid& grid, const sf::Vector2f& goal) {
+    width_ = grid.getWidth();
+    height_ = grid.getHeight();
+    cellSize_ = grid.getCellSize();
+    goal_ = goal;
+    revision_ = grid.getRevision();
+    const size_t cellCount = static_cast<size_t>(width_) * height_;
+    distance_.assign(cellCount, unreachable());
+    direction_.assign(cellCount, sf::Vector2f(0.0f, 0.0f));
+    maxDistance_ = 0.0f;
+    lastUpdatedCells_ = 0;
+    rhs_.assign(cellCount, unreachable());
+    dirtyMark_.assign(cellCount, 0);
+    repairEpoch_ = 0;
+
+    sf::Vector2i goalGrid = grid.worldToGrid(goal);
+    goalCell_ = grid.isWalkable(goalGrid.x, goalGrid.y) ? goalGrid.y * width_ + goalGrid.x : -1;
+    if (goalCell_ < 0) return;
+
+    // Integration pass: Dijkstra with lazy deletion, min-heap on distance
+    auto later = std::greater<std::pair<float, int>>();
+    open_.clear();
+    distance_[goalCell_] = 0.0f;
+    open_.emplace_back(0.0f, goalCell_);
+    while (!open_.empty()) {
+        std::pop_heap(open_.begin(), open_.end(), later);
+        auto [cost, cell] = open_.back();
+        open_.pop_back();
+        if (cost > distance_[cell]) continue;
+        maxDistance_ = cost;
+        lastUpdatedCells_++;
+        int cx = cell % width_;
+        int cy = cell / width_;
+        uint32_t neighborhood = grid.neighborhood(cx, cy);
+        for (int i = 0; i < 8; ++i) {
+            if (!canStep(neighborhood, i)) continue;
+            int nx = cx + kNeighborX[i];
+            int ny = cy + kNeighborY[i];
+            bool diagonal = i >= 4;
+            float next = cost + (diagonal ? kDiagonal : 1.0f);
+            int neighbor = ny * width_ + nx;
+            if (next < distance_[neighbor]) {
+                distance_[neighbor] = next;
+                open_.emplace_back(next, neighbor);
+                std::push_heap(open_.begin(), open_.end(), later);
+            }
+        }
+    }
+
+    // Dijkstra relaxes every edge with the same sums, so the lookahead starts out consistent
+    rhs_ = distance_;
+
+    // Direction pass: every cell points at its cheapest walkable neighbour
+    for (int cell = 0; cell < static_cast<int>(cellCount); ++cell) updateDirection(grid, cell);
+}
+
+bool FlowField::rebuildIfStale(const Grid& grid) {
+    if (!isBuilt()) return false;  // no goal yet
+    if (width_ != grid.getWidth() || height_ != grid.getHeight()) {
+        build(grid, goal_);
+        return true;
+    }
+    if (revision_ == grid.getRevision()) return false;
+    if (!repair(grid)) build(grid, goal_);
+    return true;
+}
+
+bool FlowField::repair(const Grid& grid) {
+    if (goalCell_ < 0) return false;
+    changed_.clear();
+    bool goalChanged = false;
+    bool covered = grid.forEachChangeSince(revision_, [&](const Grid::CellChange& change) {
+        int cell = change.y * width_ + change.x;
+        goalChanged |= cell == goalCell_;
+        changed_.push_back(cell);
+    });
+    if (!covered || goalChanged) return false;
+    revision_ = grid.getRevision();
+    lastUpdatedCells_ = 0;
+    dirty_.clear();
+    if (++repairEpoch_ == 0) {
+        std::fill(dirtyMark_.begin(), dirtyMark_.end(), 0);
+        repairEpoch_ = 1;
+    }
+
+    // An edit changes the edges of its own cell and, through the corner rule,
+    // the diagonals between its neighbours, so its whole 3x3 is re-evaluated
+    auto later = std::greater<std::pair<float, int>>();
+    open_.clear();
+    for (int cell : changed_) {
+        int cx = cell % width_;
+        int cy = cell / width_;
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dx = -1; dx <= 1; ++dx) {
+                int nx = cx + dx;
+                int ny = cy + dy;
+                if (nx < 0 || nx >= width_ || ny < 0 || ny >= height_) continue;
+                updateLookahead(grid, ny * width_ + nx);
+            }
+        }
+        markDirections(cell);
+    }
+
+    // Queue entries are never removed; one whose key no longer matches its
+    // cell is stale and skipped
+    while (!open_.empty()) {
+        std::pop_heap(open_.begin(), open_.end(), later);
+        auto [key, cell] = open_.back();
+        open_.pop_back();
+        float distance = distance_[cell];
+        float rhs = rhs_[cell];
+        if (distance == rhs || key != std::min(distance, rhs)) continue;
+        lastUpdatedCells_++;
+        int cx = cell % width_;
+        int cy = cell / width_;
+        uint32_t neighborhood = grid.neighborhood(cx, cy);
+        if (rhs < distance) {
+            // Overconsistent: a shorter way was found. Settle it and offer it
+            // to the neighbours, which only needs a compare per edge
+            distance_[cell] = rhs;
+            maxDistance_ = std::max(maxDistance_, rhs);
+            for (int i = 0; i < 8; ++i) {
+                if (!canStep(neighborhood, i)) continue;
+                int neighbor = (cy + kNeighborY[i]) * width_ + cx + kNeighborX[i];
+                float offer = rhs + (i >= 4 ? kDiagonal : 1.0f);
+                if (neighbor == goalCell_ || offer >= rhs_[neighbor]) continue;
+                rhs_[neighbor] = offer;
+                open_.emplace_back(std::min(offer, distance_[neighbor]), neighbor);
+                std::push_heap(open_.begin(), open_.end(), later);
+            }
+        } else {
+            // Underconsistent: the old route is gone. Drop it; only neighbours
+            // whose lookahead came through this cell need a fresh one
+            distance_[cell] = unreachable();
+            updateLookahead(grid, cell);
+            for (int i = 0; i < 8; ++i) {
+                if (!canStep(neighborhood, i)) continue;
+                int neighbor = (cy + kNeighborY[i]) * width_ + cx + kNeighborX[i];
+                if (rhs_[neighbor] == distance + (i >= 4 ? kDiagonal : 1.0f)) updateLookahead(grid, neighbor);
+            }
+        }
+        markDirections(cell);
+    }
+
+    for (int cell : dirty_) updateDirection(grid, cell);
+    return true;
+}
+
+void FlowField::updateLookahead(const Grid& grid, int cell) {
+    if (cell == goalCell_) return;
+    int cx = cell % width_;
+    int cy = cell / width_;
+    float best = unreachable();
+    uint32_t neighborhood = grid.neighborhood(cx, cy);
+    if (Grid::isOpen(neighborhood, 0, 0)) {
+        for (int i = 0; i < 8; ++i) {
+            if (!canStep(neighborhood, i)) continue;
+            int neighbor = (cy + kNeighborY[i]) * width_ + cx + kNeighborX[i];
+            best = std::min(best, distance_[neighbor] + (i >= 4 ? kDiagonal : 1.0f));
+        }
+    }
+    rhs_[cell] = best;
+    if (best != distance_[cell]) {
+        open_.emplace_back(std::min(best, distance_[cell]), cell);
+        std::push_heap(open_.begin(), open_.end(), std::greater<std::pair<float, int>>());
+    }
+}
+
+bool FlowField::canStep(uint32_t neighborhood, int direction) {
+    int dx = kNeighborX[direction];
+    int dy = kNeighborY[direction];
+    if (!Grid::isOpen(neighborhood, dx, dy)) return false;
+    // Diagonals need both orthogonal cells open so agents can't clip a corner
+    return direction < 4 || (Grid::isOpen(neighborhood, dx, 0) && Grid::isOpen(neighborhood, 0, dy));
+}
+
+void FlowField::updateDirection(const Grid& grid, int cell) {
+    direction_[cell] = sf::Vector2f(0.0f, 0.0f);
+    if (cell == goalCell_) return;
+    int x = cell % width_;
+    int y = cell / width_;
+    uint32_t neighborhood = grid.neighborhood(x, y);
+    bool blocked = !Grid::isOpen(neighborhood, 0, 0);
+    float best = distance_[cell];
+    int bestDir = -1;
+    for (int i = 0; i < 8; ++i) {
+        int nx = x + kNeighborX[i];
+        int ny = y + kNeighborY[i];
+        if (nx < 0 || nx >= width_ || ny < 0 || ny >= height_) continue;
+        if (i >= 4 && !blocked && (!Grid::isOpen(neighborhood, kNeighborX[i], 0) || !Grid::isOpen(neighborhood, 0, kNeighborY[i]))) continue;
+        float candidate = distance_[ny * width_ + nx];
+        if (candidate < best) {
+            best = candidate;
+            bestDir = i;
+        }
+    }
+    if (bestDir < 0) return;
+    float length = (bestDir >= 4) ? kDiagonal : 1.0f;
+    direction_[cell] = sf::Vector2f(kNeighborX[bestDir] / length, kNeighborY[bestDir] / length);
+}
+
+void FlowField::markDirections(int cell) {
+    int cx = cell % width_;
+    int cy = cell / width_;
+    for (int dy = -1; dy <= 1; ++dy) {
+        for (int dx = -1; dx <= 1; ++dx) {
+            int nx = cx + dx;
+            int ny = cy + dy;
+            if (nx < 0 || nx >= width_ || ny < 0 || ny >= height_) continue;
+            int neighbor = ny * width_ + nx;
+            if (dirtyMark_[neighbor] == repairEpoch_) continue;
+            dirtyMark_[neighbor] = repairEpoch_;
+            dirty_.push_back(neighbor);
+        }
+    }
+}
+
+int FlowField::cellIndex(const sf::Vector2f& worldPos) const {
+    if (!isBuilt() || worldPos.x < 0.0f || worldPos.y < 0.0f) return -1;
+    int x = static_cast<int>(worldPos.x / cellSize_);
+    int y = static_cast<int>(worldPos.y / cellSize_);
+    if (x >= width_ || y >= height_) return -1;
+    return y * width_ + x;
+}
+
+sf::Vector2f FlowField::directionAt(const sf::Vector2f& worldPos) const {
+    int cell = cellIndex(worldPos);
+    return cell >= 0 ? direction_[cell] : sf::Vector2f(0.0f, 0.0f);
+}
+
+float FlowField::distanceAt(const sf::Vector2f& worldPos) const {
+    int cell = cellIndex(worldPos);
+    return cell >= 0 ? distance_[cell] * cellSize_ : unreachable();
+}
+
+bool FlowField::isReachable(const sf::Vector2f& worldPos) const {
+    int cell = cellIndex(worldPos);
+    if (cell < 0) return false;
+    // A blocked cell with a way out counts: its occupant can still leave
+    return std::isfinite(distance_[cell]) || direction_[cell] != sf::Vector2f(0.0f, 0.0f);
+}
+
+bool FlowField::isGoalCell(const sf::Vector2f& worldPos) const {
+    return goalCell_ >= 0 && cellIndex(worldPos) == goalCell_;
+}
+
+float FlowField::progressAt(const sf::Vector2f& worldPos) const {
+    int cell = cellIndex(worldPos);
+    if (cell < 0 || !std::isfinite(distance_[cell])) return 0.0f;
+    return (maxDistance_ - distance_[cell]) * cellSize_;
+}
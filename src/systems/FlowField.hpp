@@ -0,0 +1,75 @@
+#pragma once
+#include <SFML/System/Vector2.hpp>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+class Grid;
+// Goal-rooted navigation field over a walkability Grid. build() runs one
+// Dijkstra pass outward from the goal cell (8-way, no corner cutting) and
+// stores, per cell, the travel distance to the goal and a unit direction
+// towards the cheapest neighbour. Any number of agents can then steer with
+// an O(1) lookup instead of their own path search.
+// Blocked cells get no distance but still point at their best walkable
+// neighbour, so an agent caught on a freshly blocked cell walks off it.
+// Grid edits are repaired in place, D* Lite style: each cell keeps a one-step
+// lookahead (rhs) next to its distance, the journaled edits mark their
+// neighbourhood inconsistent, and only cells whose distance actually changes
+// are re-expanded. Every agent on the field is rerouted by that one pass.
+class FlowField {
+public:
+    FlowField();
+    void build(const Grid& grid, const sf::Vector2f& goal);
+    // Brings the field up to date if the grid changed since the last
+    // build or repair; true if it did. Repairs incrementally when the grid's
+    // journal still covers the edits and the goal cell is untouched,
+    // otherwise rebuilds.
+    bool rebuildIfStale(const Grid& grid);
+    // Cells whose distance the last build or repair settled
+    size_t getLastUpdatedCells() const { return lastUpdatedCells_; }
+    bool isBuilt() const { return !distance_.empty(); }
+
+    // Unit vector to follow from worldPos; zero in the goal cell and where
+    // no route exists
+    sf::Vector2f directionAt(const sf::Vector2f& worldPos) const;
+    // Path distance to the goal in world units, or unreachable()
+    float distanceAt(const sf::Vector2f& worldPos) const;
+    bool isReachable(const sf::Vector2f& worldPos) const;
+    bool isGoalCell(const sf::Vector2f& worldPos) const;
+    // Distance covered from the farthest reachable cell; grows as an agent
+    // closes on the goal, like PathFollower::progress. Repairs only ever raise
+    // the farthest distance, so compare progress between agents rather than
+    // reading it as an absolute.
+    float progressAt(const sf::Vector2f& worldPos) const;
+    const sf::Vector2f& getGoal() const { return goal_; }
+    static float unreachable();
+
+private:
+    int cellIndex(const sf::Vector2f& worldPos) const;
+    bool repair(const Grid& grid);
+    // Recomputes rhs from the neighbours' distances and queues the cell if
+    // that leaves it inconsistent
+    void updateLookahead(const Grid& grid, int cell);
+    void updateDirection(const Grid& grid, int cell);
+    // 8-way move out of the centre of a Grid::neighborhood() mask that lands
+    // on an open cell without clipping a corner
+    static bool canStep(uint32_t neighborhood, int direction);
+    // Queues the cell and its neighbours for updateDirection, once per repair
+    void markDirections(int cell);
+
+    int width_ = 0;
+    int height_ = 0;
+    float cellSize_ = 32.0f;
+    sf::Vector2f goal_;
+    int goalCell_ = -1;
+    uint64_t revision_ = 0;
+    float maxDistance_ = 0.0f;
+    size_t lastUpdatedCells_ = 0;
+    std::vector<float> distance_;            // in cells, per cell
+    std::vector<float> rhs_;                 // one-step lookahead; equals distance_ when consistent
+    std::vector<sf::Vector2f> direction_;
+    std::vector<std::pair<float, int>> open_; // min-heap on min(distance, rhs), reused across builds
+    std::vector<int> changed_;
+    std::vector<int> dirty_;                  // cells whose direction needs redoing
+    std::vector<uint32_t> dirtyMark_;
+    uint32_t repairEpoch_ = 0;
+};
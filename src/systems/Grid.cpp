@@ -1,27 +1,96 @@
 #include "../systems/Grid.hpp"
+#include <algorithm>
 #include <cmath>
-Grid::Grid(int width, int height, float cellSize) 
-    : width_(width), height_(height), cellSize_(cellSize) {
-    grid_.resize(height_, std::vector<bool>(width_, true));
+
+namespace {
+// The part of a bit run first..last that falls in the given word
+uint64_t runMask(size_t word, size_t first, size_t last) {
+    uint64_t mask = ~0ull;
+    if (word == (first >> 6)) mask &= ~0ull << (first & 63);
+    if (word == (last >> 6)) mask &= ~0ull >> (63 - (last & 63));
+    return mask;
 }
-bool Grid::isWalkable(int x, int y) const {
-    if (x < 0 || x >= width_ || y < 0 || y >= height_) 
-        return false;
-    return grid_[y][x];
+}
+
+Grid::Grid(int width, int height, float cellSize, bool walkable) 
+    : width_(std::max(width, 0)), height_(std::max(height, 0)), cellSize_(cellSize) {
+    stride_ = (static_cast<size_t>(width_) + 2 + 63) / 64;
+    bits_.assign((static_cast<size_t>(height_) + 2) * stride_, 0);
+    // The padding stays blocked whatever the cells start as
+    for (int y = 0; y < height_ && width_ > 0 && walkable; ++y) {
+        size_t first = bitIndex(0, y);
+        size_t last = bitIndex(width_ - 1, y);
+        for (size_t word = first >> 6; word <= (last >> 6); ++word) bits_[word] |= runMask(word, first, last);
+    }
 }
 bool Grid::isWalkable(const sf::Vector2f& worldPos) const {
     sf::Vector2i gridPos = worldToGrid(worldPos);
     return isWalkable(gridPos.x, gridPos.y);
 }
 void Grid::setWalkable(int x, int y, bool walkable) {
-    if (x >= 0 && x < width_ && y >= 0 && y < height_) {
-        grid_[y][x] = walkable;
+    if (x >= 0 && x < width_ && y >= 0 && y < height_ && isWalkable(x, y) != walkable) {
+        size_t bit = bitIndex(x, y);
+        bits_[bit >> 6] ^= 1ull << (bit & 63);
+        revision_++;
+        journal_.push_back({ revision_, x, y, walkable });
+        if (journal_.size() > kJournalSize) journal_.pop_front();
     }
 }
 void Grid::setWalkable(const sf::Vector2f& worldPos, bool walkable) {
     sf::Vector2i gridPos = worldToGrid(worldPos);
     setWalkable(gridPos.x, gridPos.y, walkable);
 }
+bool Grid::isWideRunWalkable(size_t firstBit, size_t lastBit) const {
+    for (size_t word = firstBit >> 6; word <= (lastBit >> 6); ++word) {
+        uint64_t mask = runMask(word, firstBit, lastBit);
+        if ((bits_[word] & mask) != mask) return false;
+    }
+    return true;
+}
+bool Grid::isLineWalkable(int x0, int y0, int x1, int y1) const {
+    // Both ends inside the grid puts every cell between them inside too
+    if (!isWalkable(x0, y0) || !isWalkable(x1, y1)) return false;
+    const int dx = std::abs(x1 - x0);
+    const int dy = std::abs(y1 - y0);
+    const int sx = (x0 < x1) ? 1 : -1;
+    const int sy = (y0 < y1) ? 1 : -1;
+    int err = dx - dy;
+    if (dx < dy) {
+        // Steep: y steps every time, so walk the bit index a row at a time
+        const int64_t rowStep = sy * static_cast<int64_t>(stride_) * 64;
+        int64_t bit = static_cast<int64_t>(bitIndex(x0, y0));
+        for (int i = 0; i < dy; ++i) {
+            if (2 * err > -dy) {
+                err -= dy;
+                bit += sx;
+            }
+            err += dx;
+            bit += rowStep;
+            if (!testBit(static_cast<size_t>(bit))) return false;
+        }
+        return true;
+    }
+    // Shallow: x steps every time and the cells on a row form one run, whose
+    // length follows from the error term
+    int x = x0;
+    int y = y0;
+    while (true) {
+        int run = 2 * err >= dx ? (dy == 0 ? dx : (2 * err - dx) / (2 * dy) + 1) : 0;  // x-only steps left on this row
+        int runEnd = std::abs(x1 - x) <= run ? x1 : x + run * sx;
+        size_t first = bitIndex(std::min(x, runEnd), y);
+        size_t last = bitIndex(std::max(x, runEnd), y);
+        if ((first >> 6) == (last >> 6)) {
+            uint64_t mask = (~0ull >> (63 - (last - first))) << (first & 63);
+            if ((bits_[first >> 6] & mask) != mask) return false;
+        } else if (!isWideRunWalkable(first, last)) {
+            return false;
+        }
+        if (runEnd == x1) return true;
+        x = runEnd + sx;
+        y += sy;
+        err += dx - (run + 1) * dy;
+    }
+}
 sf::Vector2f Grid::gridToWorld(int gridX, int gridY) const {
     return sf::Vector2f(
         gridX * cellSize_ + cellSize_ / 2.0f,
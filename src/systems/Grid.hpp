@@ -1,21 +1,95 @@
 #pragma once
 #include <vector>
+#include <deque>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
 #include <SFML/System/Vector2.hpp>
+// Walkability as a flat bitset, one bit per cell, rows padded to whole 64-bit
+// words. A blocked border one cell wide sits around the map, so the 3x3
+// neighbourhood of any in-grid cell reads without bounds checks, and runs
+// along a row are tested a word at a time.
 class Grid {
 public:
-    Grid(int width = 20, int height = 15, float cellSize = 32.0f);
-    bool isWalkable(int x, int y) const;
+    struct CellChange {
+        uint64_t revision;  // grid revision right after this edit
+        int x, y;
+        bool walkable;
+    };
+    Grid(int width = 20, int height = 15, float cellSize = 32.0f, bool walkable = true);
+    bool isWalkable(int x, int y) const {
+        if (x < 0 || x >= width_ || y < 0 || y >= height_) return false;
+        return testBit(bitIndex(x, y));
+    }
     bool isWalkable(const sf::Vector2f& worldPos) const;
     void setWalkable(int x, int y, bool walkable);
     void setWalkable(const sf::Vector2f& worldPos, bool walkable);
+    // Cells x0..x1 (either order, inclusive) of row y are all walkable
+    bool isRunWalkable(int y, int x0, int x1) const {
+        if (x0 > x1) std::swap(x0, x1);
+        if (x0 < 0 || x1 >= width_ || y < 0 || y >= height_) return false;
+        size_t first = bitIndex(x0, y);
+        size_t last = bitIndex(x1, y);
+        if ((first >> 6) != (last >> 6)) return isWideRunWalkable(first, last);
+        uint64_t mask = (~0ull >> (63 - (last - first))) << (first & 63);
+        return (bits_[first >> 6] & mask) == mask;
+    }
+    // Every cell a Bresenham line from (x0, y0) to (x1, y1) visits is walkable.
+    // Shallow lines are tested a row-run at a time against whole words.
+    bool isLineWalkable(int x0, int y0, int x1, int y1) const;
+    // The 3x3 block around an in-grid (x, y) as 9 bits, row by row from
+    // (x - 1, y - 1); bit 4 is the cell itself. Off-grid cells read blocked.
+    uint32_t neighborhood(int x, int y) const {
+        uint32_t mask = 0;
+        for (int row = 0; row < 3; ++row) {
+            // Padded x - 1 is bit x of the row; the padding keeps x + 1 inside the stride
+            size_t bit = bitIndex(x - 1, y - 1 + row);
+            size_t shift = bit & 63;
+            uint64_t bits = bits_[bit >> 6] >> shift;
+            if (shift > 61) bits |= bits_[(bit >> 6) + 1] << (64 - shift);
+            mask |= static_cast<uint32_t>(bits & 7u) << (row * 3);
+        }
+        return mask;
+    }
+    // Tests a neighborhood() mask at offset (dx, dy), each in -1..1
+    static bool isOpen(uint32_t neighborhood, int dx, int dy) {
+        return (neighborhood >> ((dy + 1) * 3 + dx + 1)) & 1u;
+    }
     sf::Vector2f gridToWorld(int gridX, int gridY) const;
     sf::Vector2i worldToGrid(const sf::Vector2f& worldPos) const;
     int getWidth() const { return width_; }
     int getHeight() const { return height_; }
     float getCellSize() const { return cellSize_; }
-    const std::vector<std::vector<bool>>& getGrid() const { return grid_; }
+    size_t getMemoryBytes() const { return bits_.size() * sizeof(uint64_t); }
+    // Bumped whenever a cell's walkability actually changes, so derived data
+    // (flow fields, cached paths) can tell when it is stale
+    uint64_t getRevision() const { return revision_; }
+    // Calls fn(change) for each edit made after `revision`, oldest first.
+    // Returns false if the journal no longer reaches back that far.
+    template<typename Fn>
+    bool forEachChangeSince(uint64_t revision, Fn&& fn) const;
 private:
+    static const size_t kJournalSize = 1024;
+    // Bit position of (x, y) counting the padding; valid for x in -1..width, y in -1..height
+    size_t bitIndex(int x, int y) const {
+        return static_cast<size_t>(y + 1) * stride_ * 64 + static_cast<size_t>(x + 1);
+    }
+    bool testBit(size_t bit) const { return (bits_[bit >> 6] >> (bit & 63)) & 1u; }
+    bool isWideRunWalkable(size_t firstBit, size_t lastBit) const;
     int width_, height_;
     float cellSize_;
-    std::vector<std::vector<bool>> grid_;
-};
\ No newline at end of file
+    size_t stride_;               // words per padded row
+    std::vector<uint64_t> bits_;  // 1 = walkable
+    uint64_t revision_ = 0;
+    std::deque<CellChange> journal_;  // most recent kJournalSize edits
+};
+
+template<typename Fn>
+bool Grid::forEachChangeSince(uint64_t revision, Fn&& fn) const {
+    if (revision >= revision_) return true;
+    if (journal_.empty() || journal_.front().revision > revision + 1) return false;
+    // Revisions are consecutive, so the first change to replay sits at a known offset
+    size_t first = static_cast<size_t>(revision + 1 - journal_.front().revision);
+    for (size_t i = first; i < journal_.size(); ++i) fn(journal_[i]);
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,410 @@
+#include "../systems/HierarchicalPathfinder.hpp"
+#include "../systems/Grid.hpp"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+
+namespace {
+const float kInfinity = std::numeric_limits<float>::infinity();
+const float kDiagonal = 1.414f;
+// Runs of open border cells at least this long get an entrance at each end
+const int kWideEntrance = 6;
+
+float octile(int x1, int y1, int x2, int y2) {
+    int dx = std::abs(x1 - x2);
+    int dy = std::abs(y1 - y2);
+    return kDiagonal * std::min(dx, dy) + std::abs(dx - dy);
+}
+}
+
+HierarchicalPathfinder::HierarchicalPathfinder(const Grid& grid, int clusterSize)
+    : grid_(grid), clusterSize_(std::max(4, clusterSize)) {
+    rebuild();
+}
+
+bool HierarchicalPathfinder::walkable(int x, int y) const {
+    return grid_.isWalkable(x, y);
+}
+
+int HierarchicalPathfinder::clusterOf(int cell) const {
+    int x = cell % width_;
+    int y = cell / width_;
+    return (y / clusterSize_) * clustersX_ + x / clusterSize_;
+}
+
+void HierarchicalPathfinder::clusterBounds(int cluster, int& x0, int& y0, int& x1, int& y1) const {
+    x0 = (cluster % clustersX_) * clusterSize_;
+    y0 = (cluster / clustersX_) * clusterSize_;
+    x1 = std::min(x0 + clusterSize_, width_) - 1;
+    y1 = std::min(y0 + clusterSize_, height_) - 1;
+}
+
+void HierarchicalPathfinder::rebuild() {
+    width_ = grid_.getWidth();
+    height_ = grid_.getHeight();
+    clustersX_ = (width_ + clusterSize_ - 1) / clusterSize_;
+    clustersY_ = (height_ + clusterSize_ - 1) / clusterSize_;
+    revision_ = grid_.getRevision();
+    const size_t clusterCount = static_cast<size_t>(clustersX_) * clustersY_;
+    nodes_.clear();
+    freeNodes_.clear();
+    clusterNodes_.assign(clusterCount, {});
+    borderNodes_.assign(clusterCount * 2, {});
+    const size_t cellCount = static_cast<size_t>(width_) * height_;
+    cellCost_.assign(cellCount, kInfinity);
+    cellParent_.assign(cellCount, -1);
+    cellEpoch_.assign(cellCount, 0);
+    cellSearch_ = 0;
+
+    for (size_t border = 0; border < borderNodes_.size(); ++border) buildBorder(static_cast<int>(border));
+    for (size_t cluster = 0; cluster < clusterCount; ++cluster) buildIntraEdges(static_cast<int>(cluster));
+    clustersRebuilt_ = clusterCount;
+}
+
+void HierarchicalPathfinder::update() {
+    if (grid_.getWidth() != width_ || grid_.getHeight() != height_) {
+        rebuild();
+        return;
+    }
+    if (revision_ == grid_.getRevision()) return;
+
+    std::vector<int> borders;
+    std::vector<int> clusters;
+    bool journaled = grid_.forEachChangeSince(revision_, [&](const Grid::CellChange& change) {
+        int cx = change.x / clusterSize_;
+        int cy = change.y / clusterSize_;
+        int cluster = cy * clustersX_ + cx;
+        clusters.push_back(cluster);
+        // A cell on a cluster edge can open or close an entrance on that
+        // border. East borders also own the diagonals into the rows above
+        // and below, so an edge cell in a cluster's corner touches those too.
+        int lx = change.x % clusterSize_;
+        int ly = change.y % clusterSize_;
+        if (lx == clusterSize_ - 1 && cx + 1 < clustersX_) borders.push_back(cluster * 2);
+        if (lx == 0 && cx > 0) {
+            borders.push_back((cluster - 1) * 2);
+            if (ly == 0 && cy > 0) borders.push_back((cluster - 1 - clustersX_) * 2);
+            if (ly == clusterSize_ - 1 && cy + 1 < clustersY_) borders.push_back((cluster - 1 + clustersX_) * 2);
+        }
+        if (ly == clusterSize_ - 1 && cy + 1 < clustersY_) borders.push_back(cluster * 2 + 1);
+        if (ly == 0 && cy > 0) borders.push_back((cluster - clustersX_) * 2 + 1);
+    });
+    revision_ = grid_.getRevision();
+    if (!journaled) {
+        rebuild();
+        return;
+    }
+
+    std::sort(borders.begin(), borders.end());
+    borders.erase(std::unique(borders.begin(), borders.end()), borders.end());
+    // Every cluster that loses or gains an entrance node needs its inner edges redone
+    for (int border : borders) {
+        for (int id : borderNodes_[border]) clusters.push_back(nodes_[id].cluster);
+        clearBorder(border);
+        buildBorder(border);
+        for (int id : borderNodes_[border]) clusters.push_back(nodes_[id].cluster);
+    }
+    std::sort(clusters.begin(), clusters.end());
+    clusters.erase(std::unique(clusters.begin(), clusters.end()), clusters.end());
+    for (int cluster : clusters) buildIntraEdges(cluster);
+    clustersRebuilt_ = clusters.size();
+}
+
+int HierarchicalPathfinder::addNode(int cell, int cluster, int border) {
+    int id;
+    if (!freeNodes_.empty()) {
+        id = freeNodes_.back();
+        freeNodes_.pop_back();
+    } else {
+        id = static_cast<int>(nodes_.size());
+        nodes_.emplace_back();
+    }
+    Node& node = nodes_[id];
+    node.cell = cell;
+    node.cluster = cluster;
+    node.border = border;
+    node.alive = true;
+    node.edges.clear();
+    clusterNodes_[cluster].push_back(id);
+    return id;
+}
+
+void HierarchicalPathfinder::removeNode(int id) {
+    Node& node = nodes_[id];
+    auto& members = clusterNodes_[node.cluster];
+    members.erase(std::remove(members.begin(), members.end(), id), members.end());
+    node.alive = false;
+    node.edges.clear();
+    freeNodes_.push_back(id);
+}
+
+void HierarchicalPathfinder::clearBorder(int border) {
+    for (int id : borderNodes_[border]) removeNode(id);
+    borderNodes_[border].clear();
+}
+
+// Border 2c is the east edge of cluster c, 2c + 1 its south edge. A border
+// owns every move from its inner line of cells to the line across, diagonals
+// included. The east border's diagonals past its ends land in the clusters
+// above or below the neighbour; the south border leaves those to the east
+// borders, so each move across a cluster edge belongs to one border.
+void HierarchicalPathfinder::buildBorder(int border) {
+    int cluster = border / 2;
+    bool east = border % 2 == 0;
+    int cx = cluster % clustersX_;
+    int cy = cluster / clustersX_;
+    if (east ? cx + 1 >= clustersX_ : cy + 1 >= clustersY_) return;
+    int x0, y0, x1, y1;
+    clusterBounds(cluster, x0, y0, x1, y1);
+    int length = east ? y1 - y0 + 1 : x1 - x0 + 1;
+
+    // Inner side (this cluster) and outer side (the neighbour) of position i
+    auto inner = [&](int i) { return east ? sf::Vector2i(x1, y0 + i) : sf::Vector2i(x0 + i, y1); };
+    auto outer = [&](int i) { return east ? sf::Vector2i(x1 + 1, y0 + i) : sf::Vector2i(x0 + i, y1 + 1); };
+    auto open = [&](int i) {
+        sf::Vector2i a = inner(i), b = outer(i);
+        return walkable(a.x, a.y) && walkable(b.x, b.y);
+    };
+    // Entrance from inner position i to outer position j
+    auto link = [&](int i, int j, float cost) {
+        sf::Vector2i a = inner(i), b = outer(j);
+        int cellB = b.y * width_ + b.x;
+        int nodeA = addNode(a.y * width_ + a.x, cluster, border);
+        int nodeB = addNode(cellB, clusterOf(cellB), border);
+        nodes_[nodeA].edges.push_back({ nodeB, cost, true });
+        nodes_[nodeB].edges.push_back({ nodeA, cost, true });
+        borderNodes_[border].push_back(nodeA);
+        borderNodes_[border].push_back(nodeB);
+    };
+
+    for (int i = 0; i < length;) {
+        if (!open(i)) {
+            ++i;
+            continue;
+        }
+        int start = i;
+        while (i < length && open(i)) ++i;
+        int end = i - 1;
+        if (end - start + 1 >= kWideEntrance) {
+            link(start, start, 1.0f);
+            link(end, end, 1.0f);
+        } else {
+            link((start + end) / 2, (start + end) / 2, 1.0f);
+        }
+    }
+
+    // Diagonal crossings (corners may be cut, as in PathfindingSystem). One
+    // beside a straight crossing is reachable through that run's entrance,
+    // so only the rest need one of their own.
+    for (int i = 0; i < length; ++i) {
+        sf::Vector2i a = inner(i);
+        if (!walkable(a.x, a.y) || open(i)) continue;
+        for (int j : { i - 1, i + 1 }) {
+            bool alongBorder = j >= 0 && j < length;
+            if (!alongBorder && !east) continue;
+            sf::Vector2i b = outer(j);
+            if (!walkable(b.x, b.y) || (alongBorder && open(j))) continue;
+            link(i, j, kDiagonal);
+        }
+    }
+}
+
+void HierarchicalPathfinder::buildIntraEdges(int cluster) {
+    const auto& members = clusterNodes_[cluster];
+    for (int id : members) {
+        auto& edges = nodes_[id].edges;
+        edges.erase(std::remove_if(edges.begin(), edges.end(), [](const Edge& e) { return !e.inter; }), edges.end());
+    }
+    for (size_t i = 0; i < members.size(); ++i) {
+        // One Dijkstra per node prices its links to every later node; edges are symmetric
+        if (i + 1 == members.size()) break;
+        searchCluster(cluster, nodes_[members[i]].cell, -1);
+        for (size_t j = i + 1; j < members.size(); ++j) {
+            float cost = clusterDistance(nodes_[members[j]].cell);
+            if (cost == kInfinity) continue;
+            nodes_[members[i]].edges.push_back({ members[j], cost, false });
+            nodes_[members[j]].edges.push_back({ members[i], cost, false });
+        }
+    }
+}
+
+float HierarchicalPathfinder::clusterDistance(int cell) const {
+    return cellEpoch_[cell] == cellSearch_ ? cellCost_[cell] : kInfinity;
+}
+
+float HierarchicalPathfinder::searchCluster(int cluster, int fromCell, int goalCell) {
+    if (++cellSearch_ == 0) {
+        std::fill(cellEpoch_.begin(), cellEpoch_.end(), 0);
+        cellSearch_ = 1;
+    }
+    int x0, y0, x1, y1;
+    clusterBounds(cluster, x0, y0, x1, y1);
+    const int goalX = goalCell >= 0 ? goalCell % width_ : 0;
+    const int goalY = goalCell >= 0 ? goalCell / width_ : 0;
+    auto estimate = [&](int cell) {
+        return goalCell >= 0 ? octile(cell % width_, cell / width_, goalX, goalY) : 0.0f;
+    };
+    auto later = std::greater<std::pair<float, int>>();
+
+    cellOpen_.clear();
+    cellEpoch_[fromCell] = cellSearch_;
+    cellCost_[fromCell] = 0.0f;
+    cellParent_[fromCell] = -1;
+    cellOpen_.emplace_back(estimate(fromCell), fromCell);
+    while (!cellOpen_.empty()) {
+        std::pop_heap(cellOpen_.begin(), cellOpen_.end(), later);
+        auto [priority, cell] = cellOpen_.back();
+        cellOpen_.pop_back();
+        float cost = cellCost_[cell];
+        if (priority > cost + estimate(cell) + 0.0001f) continue;  // stale entry
+        lastExpansions_++;
+        if (cell == goalCell) return cost;
+        int cx = cell % width_;
+        int cy = cell / width_;
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dx = -1; dx <= 1; ++dx) {
+                if (dx == 0 && dy == 0) continue;
+                int nx = cx + dx;
+                int ny = cy + dy;
+                if (nx < x0 || nx > x1 || ny < y0 || ny > y1 || !walkable(nx, ny)) continue;
+                int next = ny * width_ + nx;
+                float nextCost = cost + ((dx != 0 && dy != 0) ? kDiagonal : 1.0f);
+                if (cellEpoch_[next] != cellSearch_ || nextCost < cellCost_[next]) {
+                    cellEpoch_[next] = cellSearch_;
+                    cellCost_[next] = nextCost;
+                    cellParent_[next] = cell;
+                    cellOpen_.emplace_back(nextCost + estimate(next), next);
+                    std::push_heap(cellOpen_.begin(), cellOpen_.end(), later);
+                }
+            }
+        }
+    }
+    return goalCell >= 0 ? kInfinity : 0.0f;
+}
+
+bool HierarchicalPathfinder::findAbstractPath(int startCell, int goalCell, std::vector<int>& waypoints, float* cost) {
+    waypoints.clear();
+    update();
+    lastExpansions_ = 0;
+    const int startCluster = clusterOf(startCell);
+    const int goalCluster = clusterOf(goalCell);
+
+    // Same cluster: a confined search is usually the whole answer
+    if (startCluster == goalCluster) {
+        float local = searchCluster(startCluster, startCell, goalCell);
+        if (local < kInfinity) {
+            waypoints = { startCell, goalCell };
+            if (cost) *cost = local;
+            return true;
+        }
+    }
+
+    // Link start and goal into the graph without adding nodes: the start's
+    // costs seed the search, the goal's are checked as nodes are expanded
+    startLinks_.clear();
+    searchCluster(startCluster, startCell, -1);
+    for (int id : clusterNodes_[startCluster]) {
+        float linkCost = clusterDistance(nodes_[id].cell);
+        if (linkCost < kInfinity) startLinks_.emplace_back(id, linkCost);
+    }
+    goalLinks_.clear();
+    searchCluster(goalCluster, goalCell, -1);
+    for (int id : clusterNodes_[goalCluster]) {
+        float linkCost = clusterDistance(nodes_[id].cell);
+        if (linkCost < kInfinity) goalLinks_.emplace_back(id, linkCost);
+    }
+    if (startLinks_.empty() || goalLinks_.empty()) return false;
+
+    const int nodeCount = static_cast<int>(nodes_.size());
+    const int goalSlot = nodeCount;
+    if (nodeCost_.size() < nodes_.size() + 1) {
+        nodeCost_.resize(nodes_.size() + 1);
+        nodeParent_.resize(nodes_.size() + 1);
+        nodeEpoch_.resize(nodes_.size() + 1, 0);
+        nodeClosed_.resize(nodes_.size() + 1);
+    }
+    if (++nodeSearch_ == 0) {
+        std::fill(nodeEpoch_.begin(), nodeEpoch_.end(), 0);
+        nodeSearch_ = 1;
+    }
+    const int goalX = goalCell % width_;
+    const int goalY = goalCell / width_;
+    auto estimate = [&](int slot) {
+        if (slot == goalSlot) return 0.0f;
+        int cell = nodes_[slot].cell;
+        return octile(cell % width_, cell / width_, goalX, goalY);
+    };
+    auto later = std::greater<std::pair<float, int>>();
+    nodeOpen_.clear();
+    auto relax = [&](int slot, int parent, float g) {
+        if (nodeEpoch_[slot] != nodeSearch_) {
+            nodeEpoch_[slot] = nodeSearch_;
+            nodeClosed_[slot] = 0;
+        } else if (nodeClosed_[slot] || g >= nodeCost_[slot]) {
+            return;
+        }
+        nodeCost_[slot] = g;
+        nodeParent_[slot] = parent;
+        nodeOpen_.emplace_back(g + estimate(slot), slot);
+        std::push_heap(nodeOpen_.begin(), nodeOpen_.end(), later);
+    };
+    for (const auto& link : startLinks_) relax(link.first, -1, link.second);
+
+    bool found = false;
+    while (!nodeOpen_.empty()) {
+        std::pop_heap(nodeOpen_.begin(), nodeOpen_.end(), later);
+        auto [priority, slot] = nodeOpen_.back();
+        nodeOpen_.pop_back();
+        if (nodeClosed_[slot] || priority > nodeCost_[slot] + estimate(slot) + 0.0001f) continue;
+        nodeClosed_[slot] = 1;
+        lastExpansions_++;
+        if (slot == goalSlot) {
+            found = true;
+            break;
+        }
+        const Node& node = nodes_[slot];
+        float g = nodeCost_[slot];
+        for (const Edge& edge : node.edges) relax(edge.to, slot, g + edge.cost);
+        if (node.cluster == goalCluster) {
+            for (const auto& link : goalLinks_) {
+                if (link.first == slot) relax(goalSlot, slot, g + link.second);
+            }
+        }
+    }
+    if (!found) return false;
+
+    if (cost) *cost = nodeCost_[goalSlot];
+    waypoints.push_back(goalCell);
+    for (int slot = nodeParent_[goalSlot]; slot >= 0; slot = nodeParent_[slot]) {
+        waypoints.push_back(nodes_[slot].cell);
+    }
+    waypoints.push_back(startCell);
+    std::reverse(waypoints.begin(), waypoints.end());
+    // Start or goal sitting on an entrance shows up twice
+    waypoints.erase(std::unique(waypoints.begin(), waypoints.end()), waypoints.end());
+    return true;
+}
+
+void HierarchicalPathfinder::refineSegment(int fromCell, int toCell, std::vector<int>& out) {
+    if (fromCell == toCell) return;
+    int fromCluster = clusterOf(fromCell);
+    if (fromCluster != clusterOf(toCell)) {
+        // Entrance pair: neighbouring cells across the border
+        out.push_back(toCell);
+        return;
+    }
+    if (searchCluster(fromCluster, fromCell, toCell) == kInfinity) return;
+    size_t first = out.size();
+    for (int cell = toCell; cell != fromCell; cell = cellParent_[cell]) out.push_back(cell);
+    std::reverse(out.begin() + first, out.end());
+}
+
+bool HierarchicalPathfinder::findPath(int startCell, int goalCell, std::vector<int>& cells, float* cost) {
+    std::vector<int> waypoints;
+    if (!findAbstractPath(startCell, goalCell, waypoints, cost)) return false;
+    cells.clear();
+    cells.push_back(startCell);
+    for (size_t i = 0; i + 1 < waypoints.size(); ++i) refineSegment(waypoints[i], waypoints[i + 1], cells);
+    return true;
+}
@@ -0,0 +1,97 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+class Grid;
+// HPA*: the grid is cut into square clusters; where two clusters share a run
+// of open border cells, an entrance puts a linked node on each side, and so
+// does a diagonal step across a border that no such run covers. Nodes in
+// the same cluster are joined by their cached in-cluster travel cost, so a
+// long query is a search over a few hundred entrances instead of every cell.
+// The abstract route is refined to cells one segment at a time, each segment
+// being a search confined to a single cluster.
+// update() replays the Grid's change journal and rebuilds only the borders
+// and clusters the edited cells touch.
+// Moves and costs match PathfindingSystem (8-way, 1 / 1.414); routes are
+// near-optimal rather than optimal, since they must pass through entrances.
+class HierarchicalPathfinder {
+public:
+    explicit HierarchicalPathfinder(const Grid& grid, int clusterSize = 32);
+    // Brings the abstract graph in line with the grid's current revision
+    void update();
+    void rebuild();
+
+    // Abstract route from startCell to goalCell as cell indices (start and
+    // goal included). Consecutive cells are either in the same cluster or
+    // neighbours (possibly diagonal) across a border. Returns false if there is no route.
+    bool findAbstractPath(int startCell, int goalCell, std::vector<int>& waypoints, float* cost = nullptr);
+    // Appends the cells after fromCell up to and including toCell
+    void refineSegment(int fromCell, int toCell, std::vector<int>& out);
+    // Full cell-by-cell route, abstract search plus every segment refined
+    bool findPath(int startCell, int goalCell, std::vector<int>& cells, float* cost = nullptr);
+
+    int getClusterSize() const { return clusterSize_; }
+    size_t getNodeCount() const { return nodes_.size() - freeNodes_.size(); }
+    // Abstract nodes plus cells popped by the last query's searches
+    size_t getLastExpansions() const { return lastExpansions_; }
+    size_t getClustersRebuilt() const { return clustersRebuilt_; }
+
+private:
+    struct Edge {
+        int to;
+        float cost;
+        bool inter;  // crosses a border; kept when a cluster's inner edges are redone
+    };
+    struct Node {
+        int cell = -1;
+        int cluster = -1;
+        int border = -1;
+        bool alive = false;
+        std::vector<Edge> edges;
+    };
+
+    int clusterOf(int cell) const;
+    void clusterBounds(int cluster, int& x0, int& y0, int& x1, int& y1) const;
+    int addNode(int cell, int cluster, int border);
+    void removeNode(int node);
+    void buildBorder(int border);
+    void clearBorder(int border);
+    void buildIntraEdges(int cluster);
+    // Dijkstra (goalCell < 0) or A* (goalCell >= 0) over the cells of one cluster
+    float searchCluster(int cluster, int fromCell, int goalCell);
+    float clusterDistance(int cell) const;
+    bool walkable(int x, int y) const;
+
+    const Grid& grid_;
+    int clusterSize_;
+    int width_ = 0;
+    int height_ = 0;
+    int clustersX_ = 0;
+    int clustersY_ = 0;
+    uint64_t revision_ = 0;
+    std::vector<Node> nodes_;
+    std::vector<int> freeNodes_;
+    std::vector<std::vector<int>> clusterNodes_;
+    std::vector<std::vector<int>> borderNodes_;  // 2 per cluster: east, south
+
+    // Cell search scratch, stamped per search like PathfindingSystem's nodes
+    std::vector<float> cellCost_;
+    std::vector<int> cellParent_;
+    std::vector<uint32_t> cellEpoch_;
+    uint32_t cellSearch_ = 0;
+    std::vector<std::pair<float, int>> cellOpen_;
+
+    // Abstract search scratch; start and goal ride in the two slots past the real nodes
+    std::vector<float> nodeCost_;
+    std::vector<int> nodeParent_;
+    std::vector<uint32_t> nodeEpoch_;
+    std::vector<char> nodeClosed_;
+    uint32_t nodeSearch_ = 0;
+    std::vector<std::pair<float, int>> nodeOpen_;
+    std::vector<std::pair<int, float>> startLinks_;
+    std::vector<std::pair<int, float>> goalLinks_;
+
+    size_t lastExpansions_ = 0;
+    size_t clustersRebuilt_ = 0;
+};
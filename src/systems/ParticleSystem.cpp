@@ -1,20 +1,17 @@
 #include "../systems/ParticleSystem.hpp"
 #include "../utils/Random.hpp"
 #include <cmath>
-ParticleSystem::ParticleSystem(size_t max) {
-    parts_.resize(max);
-    for (auto& p : parts_) {
+ParticleSystem::ParticleSystem(size_t max) : parts_(max) {
+    for (auto& p : parts_.raw()) {
         p.alive = false;
     }
 }
 void ParticleSystem::emit(const Vec2& pos, Particle::Type type, int count) {
+    // Bursts past capacity are dropped, as before
     for (int i = 0; i < count; ++i) {
-        for (auto& p : parts_) {
-            if (!p.alive) {
-                initParticle(p, pos, type);
-                break;
-            }
-        }
+        int index = parts_.allocate();
+        if (index < 0) return;
+        initParticle(parts_.get(index), pos, type);
     }
 }
 void ParticleSystem::initParticle(Particle& p, const Vec2& pos, Particle::Type type) {
@@ -22,78 +19,77 @@ void ParticleSystem::initParticle(Particle& p, const Vec2& pos, Particle::Type t
     p.startPos = pos;
     p.alive = true;
     p.type = type;
-    p.rotation = Random::range(0.0f, 360.0f);
-    p.rotationSpeed = Random::range(-180.0f, 180.0f);
+    p.rotation = random_.range(0.0f, 360.0f);
+    p.rotationSpeed = random_.range(-180.0f, 180.0f);
     switch (type) {
         case Particle::SMOKE:
-            p.vel = Vec2(Random::range(-20.f, 20.f), Random::range(-50.f, -30.f));
-            p.life = p.maxLife = Random::range(1.0f, 2.0f);
-            p.size = Random::range(2.0f, 8.0f);
+            p.vel = Vec2(random_.range(-20.f, 20.f), random_.range(-50.f, -30.f));
+            p.life = p.maxLife = random_.range(1.0f, 2.0f);
+            p.size = random_.range(2.0f, 8.0f);
             p.startColor = sf::Color(100, 100, 100, 200);
             p.endColor = sf::Color(50, 50, 50, 0);
             break;
         case Particle::FIRE:
-            p.vel = Vec2(Random::range(-15.f, 15.f), Random::range(-40.f, -20.f));
-            p.life = p.maxLife = Random::range(0.5f, 1.2f);
-            p.size = Random::range(3.0f, 6.0f);
+            p.vel = Vec2(random_.range(-15.f, 15.f), random_.range(-40.f, -20.f));
+            p.life = p.maxLife = random_.range(0.5f, 1.2f);
+            p.size = random_.range(3.0f, 6.0f);
             p.startColor = sf::Color(255, 200, 50, 255);
             p.endColor = sf::Color(255, 50, 0, 0);
             break;
         case Particle::SPARKLE:
-            p.vel = Vec2(Random::range(-100.f, 100.f), Random::range(-100.f, 100.f));
-            p.life = p.maxLife = Random::range(0.3f, 0.8f);
-            p.size = Random::range(1.0f, 3.0f);
+            p.vel = Vec2(random_.range(-100.f, 100.f), random_.range(-100.f, 100.f));
+            p.life = p.maxLife = random_.range(0.3f, 0.8f);
+            p.size = random_.range(1.0f, 3.0f);
             p.startColor = sf::Color(255, 255, 200, 255);
             p.endColor = sf::Color(255, 255, 100, 0);
             break;
         case Particle::BLOOD:
-            p.vel = Vec2(Random::range(-80.f, 80.f), Random::range(-80.f, 80.f));
-            p.life = p.maxLife = Random::range(0.8f, 1.5f);
-            p.size = Random::range(2.0f, 5.0f);
+            p.vel = Vec2(random_.range(-80.f, 80.f), random_.range(-80.f, 80.f));
+            p.life = p.maxLife = random_.range(0.8f, 1.5f);
+            p.size = random_.range(2.0f, 5.0f);
             p.startColor = sf::Color(180, 0, 0, 255);
             p.endColor = sf::Color(100, 0, 0, 0);
             break;
         case Particle::SLIME:
-            p.vel = Vec2(Random::range(-30.f, 30.f), Random::range(-30.f, 30.f));
-            p.life = p.maxLife = Random::range(1.5f, 3.0f);
-            p.size = Random::range(3.0f, 8.0f);
+            p.vel = Vec2(random_.range(-30.f, 30.f), random_.range(-30.f, 30.f));
+            p.life = p.maxLife = random_.range(1.5f, 3.0f);
+            p.size = random_.range(3.0f, 8.0f);
             p.startColor = sf::Color(0, 200, 50, 200);
             p.endColor = sf::Color(0, 100, 25, 0);
             break;
         case Particle::FROST:
-            p.vel = Vec2(Random::range(-25.f, 25.f), Random::range(-25.f, 25.f));
-            p.life = p.maxLife = Random::range(1.0f, 2.0f);
-            p.size = Random::range(2.0f, 6.0f);
+            p.vel = Vec2(random_.range(-25.f, 25.f), random_.range(-25.f, 25.f));
+            p.life = p.maxLife = random_.range(1.0f, 2.0f);
+            p.size = random_.range(2.0f, 6.0f);
             p.startColor = sf::Color(200, 230, 255, 200);
             p.endColor = sf::Color(100, 150, 255, 0);
             break;           
         case Particle::ELECTRIC:
-            p.vel = Vec2(Random::range(-150.f, 150.f), Random::range(-150.f, 150.f));
-            p.life = p.maxLife = Random::range(0.2f, 0.5f);
-            p.size = Random::range(1.0f, 4.0f);
+            p.vel = Vec2(random_.range(-150.f, 150.f), random_.range(-150.f, 150.f));
+            p.life = p.maxLife = random_.range(0.2f, 0.5f);
+            p.size = random_.range(1.0f, 4.0f);
             p.startColor = sf::Color(200, 230, 255, 255);
             p.endColor = sf::Color(100, 150, 255, 0);
             break;
     }
 }
 void ParticleSystem::update(float dt) {
-    for (auto& p : parts_) {
-        if (p.alive) {
-            // Apply velocity
-            p.pos += p.vel * dt;
-            // Apply rotation
-            p.rotation += p.rotationSpeed * dt;
-            // Apply gravity for some types
-            if (p.type == Particle::BLOOD || p.type == Particle::SLIME) {
-                p.vel.y += 98.0f * dt; // Gravity
-            }           
-            // Update life
-            p.life -= dt;
-            if (p.life <= 0.f) {
-                p.alive = false;
-            }
+    parts_.forEachActive([this, dt](int index, Particle& p) {
+        // Apply velocity
+        p.pos += p.vel * dt;
+        // Apply rotation
+        p.rotation += p.rotationSpeed * dt;
+        // Apply gravity for some types
+        if (p.type == Particle::BLOOD || p.type == Particle::SLIME) {
+            p.vel.y += 98.0f * dt; // Gravity
         }
-    }
+        // Update life
+        p.life -= dt;
+        if (p.life <= 0.f) {
+            p.alive = false;
+            parts_.free(index);
+        }
+    });
 }
 // PHASE 3: Specific effect methods
 void ParticleSystem::emitExplosion(const Vec2& pos, float radius) {
@@ -123,4 +119,5 @@ void ParticleSystem::clear() {
     for (auto& p : parts_) {
         p.alive = false;
     }
+    parts_.clear();
 }
\ No newline at end of file
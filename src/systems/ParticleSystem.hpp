@@ -2,6 +2,8 @@
 #include <vector>
 #include <SFML/System/Vector2.hpp>
 #include <SFML/Graphics/Color.hpp>
+#include "../utils/Random.hpp"
+#include "../utils/ObjectPool.hpp"
 using Vec2 = sf::Vector2f;
 struct Particle {
     Vec2 pos;
@@ -33,7 +35,9 @@ public:
     void emit(const Vec2& pos, Particle::Type type, int count = 1);
     void update(float dt);
     void clear();
-    const std::vector<Particle>& getParticles() const { return parts_; }
+    // Every slot; dead particles have alive == false
+    const std::vector<Particle>& getParticles() const { return parts_.raw(); }
+    size_t getAliveCount() const { return parts_.size(); }
     // PHASE 3: Specific effect methods
     void emitExplosion(const Vec2& pos, float radius);
     void emitTrail(const Vec2& pos, const Vec2& direction);
@@ -43,7 +47,8 @@ public:
     void emitPoisonCloud(const Vec2& pos);
     void emitStunStars(const Vec2& pos);
 private:
-    std::vector<Particle> parts_;
+    ObjectPool<Particle> parts_;
+    Random random_;
     // PHASE 3: Helper methods
     void initParticle(Particle& p, const Vec2& pos, Particle::Type type);
 };
\ No newline at end of file
@@ -0,0 +1,145 @@
+#include "../systems/PathRegistry.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+PathRoute::Ref PathRoute::build(const std::vector<sf::Vector2f>& points, float sampleSpacing) {
+    auto route = std::make_shared<PathRoute>();
+    route->points = points;
+    route->lengths.resize(points.size());
+    route->tangents.resize(points.size());
+    float length = 0.0f;
+    sf::Vector2f tangent(0, 0);
+    for (size_t i = 0; i < points.size(); ++i) {
+        route->lengths[i] = length;
+        if (i + 1 < points.size()) {
+            sf::Vector2f segment = points[i + 1] - points[i];
+            float segmentLength = std::sqrt(segment.x * segment.x + segment.y * segment.y);
+            // Repeated waypoints keep the previous heading
+            if (segmentLength > 0.0f) tangent = segment / segmentLength;
+            length += segmentLength;
+        }
+        route->tangents[i] = tangent;
+    }
+
+    if (sampleSpacing > 0.0f && points.size() > 1) {
+        route->sampleSpacing = sampleSpacing;
+        size_t count = static_cast<size_t>(length / sampleSpacing) + 1;
+        route->samples.reserve(count + 1);
+        // Samples are in distance order, so one forward cursor covers them all
+        Cursor cursor;
+        for (size_t i = 0; i < count; ++i) {
+            route->samples.push_back(route->positionAt(i * sampleSpacing, cursor));
+        }
+        route->samples.push_back(points.back());
+    }
+    return route;
+}
+
+size_t PathRoute::segmentAt(float distance) const {
+    if (points.size() < 2) return 0;
+    // First waypoint past the distance ends the segment
+    auto end = std::upper_bound(lengths.begin() + 1, lengths.end() - 1, distance);
+    return static_cast<size_t>(end - lengths.begin()) - 1;
+}
+
+sf::Vector2f PathRoute::positionAt(float distance) const {
+    if (points.size() < 2) return points.empty() ? sf::Vector2f(0, 0) : points[0];
+    return pointOnSegment(segmentAt(distance), distance);
+}
+
+sf::Vector2f PathRoute::positionAt(float distance, Cursor& cursor) const {
+    if (points.size() < 2) return points.empty() ? sf::Vector2f(0, 0) : points[0];
+    size_t last = points.size() - 2;
+    size_t segment = std::min(cursor.segment, last);
+    // Step from the cached segment; fall back to the binary search for jumps
+    for (int steps = 0; ; ++steps) {
+        if (steps == 4) {
+            segment = segmentAt(distance);
+            break;
+        }
+        if (segment < last && distance >= lengths[segment + 1]) segment++;
+        else if (segment > 0 && distance < lengths[segment]) segment--;
+        else break;
+    }
+    cursor.segment = segment;
+    return pointOnSegment(segment, distance);
+}
+
+sf::Vector2f PathRoute::sampleAt(float distance) const {
+    if (samples.empty()) return positionAt(distance);
+    float position = std::max(0.0f, distance) / sampleSpacing;
+    size_t index = static_cast<size_t>(position);
+    if (index + 1 >= samples.size()) return samples.back();
+    float t = std::min(1.0f, position - index);
+    return samples[index] + (samples[index + 1] - samples[index]) * t;
+}
+
+sf::Vector2f PathRoute::pointOnSegment(size_t segment, float distance) const {
+    float along = std::min(std::max(distance - lengths[segment], 0.0f), lengths[segment + 1] - lengths[segment]);
+    return points[segment] + tangents[segment] * along;
+}
+
+PathRoute::Ref PathRegistry::intern(const std::vector<sf::Vector2f>& points, float sampleSpacing) {
+    // Expired entries are dropped now and then so a registry fed many
+    // one-off routes doesn't grow without bound
+    if (++internsSincePrune_ >= 256) prune();
+
+    uint64_t hash = hashPoints(points);
+    auto range = routes_.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        PathRoute::Ref route = it->second.lock();
+        if (route && route->points == points && route->sampleSpacing == sampleSpacing) return route;
+    }
+
+    PathRoute::Ref route = PathRoute::build(points, sampleSpacing);
+    routes_.emplace(hash, route);
+    return route;
+}
+
+void PathRegistry::prune() {
+    internsSincePrune_ = 0;
+    for (auto it = routes_.begin(); it != routes_.end();) {
+        it = it->second.expired() ? routes_.erase(it) : std::next(it);
+    }
+}
+
+void PathRegistry::clear() {
+    routes_.clear();
+    internsSincePrune_ = 0;
+}
+
+size_t PathRegistry::getRouteCount() const {
+    size_t count = 0;
+    for (const auto& entry : routes_) count += !entry.second.expired();
+    return count;
+}
+
+size_t PathRegistry::getMemoryBytes() const {
+    size_t bytes = sizeof(*this);
+    for (const auto& entry : routes_) {
+        bytes += sizeof(entry) + sizeof(void*);
+        if (PathRoute::Ref route = entry.second.lock()) {
+            bytes += sizeof(PathRoute) + route->lengths.capacity() * sizeof(float)
+                   + (route->points.capacity() + route->tangents.capacity() + route->samples.capacity())
+                     * sizeof(sf::Vector2f);
+        }
+    }
+    return bytes;
+}
+
+// FNV-1a over the coordinates' bits; equal routes hash equal, and equal()
+// on the points settles collisions
+uint64_t PathRegistry::hashPoints(const std::vector<sf::Vector2f>& points) {
+    uint64_t hash = 14695981039346656037ull;
+    for (const auto& point : points) {
+        uint32_t bits[2];
+        std::memcpy(&bits[0], &point.x, sizeof(float));
+        std::memcpy(&bits[1], &point.y, sizeof(float));
+        for (uint32_t word : bits) {
+            hash ^= word;
+            hash *= 1099511628211ull;
+        }
+    }
+    return hash;
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include <SFML/System/Vector2.hpp>
+
+// One immutable route with its arc-length table, built once: cumulative
+// length and unit tangent per waypoint, plus the route resampled at a fixed
+// spacing. Followers on the route share it through a PathRoute::Ref and keep
+// only their own cursor.
+struct PathRoute {
+    using Ref = std::shared_ptr<const PathRoute>;
+    // Segment last looked up; positionAt() with a cursor starts its search there
+    struct Cursor {
+        size_t segment = 0;
+    };
+
+    std::vector<sf::Vector2f> points;
+    std::vector<float> lengths;          // lengths[i] = arc length from points[0] to points[i]
+    std::vector<sf::Vector2f> tangents;  // unit direction of segment i; the last point repeats it
+    std::vector<sf::Vector2f> samples;   // a point every sampleSpacing along the route, then the end
+    float sampleSpacing = 0.0f;          // 0 = not resampled
+
+    static Ref build(const std::vector<sf::Vector2f>& points, float sampleSpacing = 8.0f);
+
+    size_t size() const { return points.size(); }
+    float totalLength() const { return lengths.empty() ? 0.0f : lengths.back(); }
+    // Segment containing the distance (clamped to the route), by binary search
+    size_t segmentAt(float distance) const;
+    sf::Vector2f positionAt(float distance) const;
+    // O(1) when distance moved by about a segment or less since the last call
+    sf::Vector2f positionAt(float distance, Cursor& cursor) const;
+    sf::Vector2f tangentAt(float distance) const { return tangents.empty() ? sf::Vector2f(0, 0) : tangents[segmentAt(distance)]; }
+    // Straight from the uniform samples: O(1), but cuts corners by up to
+    // half a sample spacing
+    sf::Vector2f sampleAt(float distance) const;
+
+private:
+    sf::Vector2f pointOnSegment(size_t segment, float distance) const;
+};
+
+// Interns routes so every follower on the same waypoints references one copy.
+// Routes are reference-counted: one is freed when its last Ref goes away, and
+// the registry drops its entry for it on a later intern() or prune().
+class PathRegistry {
+public:
+    // The shared route for these waypoints, built on first sight. Hashes the
+    // points, so callers spawning many followers should keep the Ref it returns.
+    PathRoute::Ref intern(const std::vector<sf::Vector2f>& points, float sampleSpacing = 8.0f);
+    void prune();  // forget routes nobody references any more
+    void clear();
+
+    size_t getRouteCount() const;  // routes still referenced
+    size_t getMemoryBytes() const;
+
+private:
+    static uint64_t hashPoints(const std::vector<sf::Vector2f>& points);
+
+    std::unordered_multimap<uint64_t, std::weak_ptr<const PathRoute>> routes_;
+    size_t internsSincePrune_ = 0;
+};
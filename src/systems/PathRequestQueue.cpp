@@ -0,0 +1,138 @@
+#include "../systems/PathRequestQueue.hpp"
+#include "../systems/Grid.hpp"
+#include <algorithm>
+
+PathRequestQueue::PathRequestQueue(int workerCount) {
+    int cores = static_cast<int>(std::thread::hardware_concurrency());
+    workerCount_ = workerCount > 0 ? workerCount : std::max(1, cores - 1);
+}
+
+PathRequestQueue::~PathRequestQueue() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (auto& worker : workers_) worker.join();
+}
+
+void PathRequestQueue::setGrid(const Grid* grid) {
+    cancelAll();
+    grid_ = grid;
+    snapshot_.reset();
+    generation_++;
+}
+
+PathRequestQueue::Ticket PathRequestQueue::request(const Vec2& start, const Vec2& goal, Callback onReady,
+                                                   Priority priority, PathfindingSystem::SearchMode mode) {
+    if (!grid_) return 0;
+    // Edits since the last snapshot mean a fresh copy; otherwise requests share one
+    if (!snapshot_ || snapshot_->getRevision() != grid_->getRevision()) {
+        snapshot_ = std::make_shared<const Grid>(*grid_);
+    }
+    if (workers_.empty()) startWorkers();
+
+    Ticket ticket = nextTicket_++;
+    callbacks_[ticket] = std::move(onReady);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        jobs_.push_back({ ticket, priority, start, goal, mode, snapshot_, generation_ });
+        std::push_heap(jobs_.begin(), jobs_.end(), JobOrder());
+        queued_.insert(ticket);
+    }
+    wake_.notify_one();
+    return ticket;
+}
+
+bool PathRequestQueue::cancel(Ticket ticket) {
+    if (callbacks_.erase(ticket) == 0) return false;
+    // Still queued: the worker that pops it will skip it
+    std::lock_guard<std::mutex> lock(mutex_);
+    queued_.erase(ticket);
+    return true;
+}
+
+void PathRequestQueue::cancelAll() {
+    callbacks_.clear();
+    std::lock_guard<std::mutex> lock(mutex_);
+    jobs_.clear();
+    queued_.clear();
+    finished_.clear();
+}
+
+size_t PathRequestQueue::deliver() {
+    // Nothing outstanding: skip the lock, the common case in a game tick
+    if (callbacks_.empty()) return 0;
+    std::vector<Result> results;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (finished_.empty()) return 0;
+        results.swap(finished_);
+    }
+    // Tickets in order, so delivery doesn't depend on which worker finished first
+    std::sort(results.begin(), results.end(), [](const Result& a, const Result& b) { return a.ticket < b.ticket; });
+    size_t delivered = 0;
+    for (const Result& result : results) {
+        auto callback = callbacks_.find(result.ticket);
+        if (callback == callbacks_.end()) continue;  // cancelled while running
+        Callback onReady = std::move(callback->second);
+        callbacks_.erase(callback);
+        if (onReady) onReady(result);
+        delivered++;
+    }
+    return delivered;
+}
+
+void PathRequestQueue::waitIdle() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this]() { return jobs_.empty() && running_ == 0; });
+}
+
+void PathRequestQueue::startWorkers() {
+    for (int i = 0; i < workerCount_; ++i) {
+        workers_.emplace_back([this]() { workerLoop(); });
+    }
+}
+
+void PathRequestQueue::workerLoop() {
+    // Each worker keeps its own search state and grid copy; the copy is only
+    // refreshed when a job brings a newer snapshot, and a snapshot that
+    // continues the same grid's history keeps the worker's path cache
+    PathfindingSystem pathfinding;
+    uint64_t loadedGeneration = 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        wake_.wait(lock, [this]() { return stopping_ || !jobs_.empty(); });
+        if (stopping_) return;
+        std::pop_heap(jobs_.begin(), jobs_.end(), JobOrder());
+        Job job = std::move(jobs_.back());
+        jobs_.pop_back();
+        if (queued_.erase(job.ticket) == 0) {
+            if (jobs_.empty() && running_ == 0) idle_.notify_all();
+            continue;  // cancelled before it started
+        }
+        running_++;
+        lock.unlock();
+
+        if (job.generation != loadedGeneration) {
+            // A different grid altogether; nothing the worker cached carries over
+            pathfinding.initialize(job.snapshot->getWidth(), job.snapshot->getHeight(), job.snapshot->getCellSize());
+            pathfinding.loadGrid(*job.snapshot);
+            loadedGeneration = job.generation;
+        } else if (pathfinding.getGrid()->getRevision() != job.snapshot->getRevision()) {
+            pathfinding.loadGrid(*job.snapshot);
+        }
+        Result result;
+        result.ticket = job.ticket;
+        result.path = pathfinding.findPath(job.start, job.goal, job.mode);
+        result.found = !result.path.empty();
+        result.revision = job.snapshot->getRevision();
+        job.snapshot.reset();
+
+        lock.lock();
+        running_--;
+        // Cancelled meanwhile or not, deliver() sorts that out
+        finished_.push_back(std::move(result));
+        if (jobs_.empty() && running_ == 0) idle_.notify_all();
+    }
+}
@@ -0,0 +1,94 @@
+#pragma once
+#include <SFML/System/Vector2.hpp>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "../systems/PathfindingSystem.hpp"
+class Grid;
+// Runs findPath off the main thread. request() hands back a ticket at once;
+// the search runs on a worker pool against an immutable snapshot of the grid
+// taken at request time, and its result is handed to the callback from
+// deliver(), which the simulation calls at the start of each tick. A result
+// therefore arrives a tick or more after it was asked for, and an agent keeps
+// following its old path until then.
+// request(), cancel(), deliver() and setGrid() are main-thread calls.
+// Workers start on the first request, so a queue that is never used costs
+// no threads. Simulation owns one and delivers it every tick, but no game
+// system requests paths through it yet; HotPathBench is its only caller.
+class PathRequestQueue {
+public:
+    using Ticket = uint64_t;  // 0 is never issued
+    enum class Priority { LOW, NORMAL, HIGH };
+    struct Result {
+        Ticket ticket = 0;
+        bool found = false;
+        std::vector<Vec2> path;   // smoothed, as PathfindingSystem::findPath returns it
+        uint64_t revision = 0;    // grid revision the path was found on
+    };
+    using Callback = std::function<void(const Result&)>;
+
+    explicit PathRequestQueue(int workerCount = 0);  // 0 = one fewer than the cores, at least 1
+    ~PathRequestQueue();
+    PathRequestQueue(const PathRequestQueue&) = delete;
+    PathRequestQueue& operator=(const PathRequestQueue&) = delete;
+
+    // Grid that requests snapshot; pending requests are cancelled when it changes
+    void setGrid(const Grid* grid);
+    Ticket request(const Vec2& start, const Vec2& goal, Callback onReady,
+                   Priority priority = Priority::NORMAL,
+                   PathfindingSystem::SearchMode mode = PathfindingSystem::SearchMode::ASTAR);
+    // False if the ticket was already delivered or cancelled. A search
+    // already running finishes, but its result is dropped.
+    bool cancel(Ticket ticket);
+    void cancelAll();
+    // Runs the callbacks of every finished request; returns how many ran
+    size_t deliver();
+    // Blocks until nothing is queued or running (for tests and tools)
+    void waitIdle();
+    size_t getPendingCount() const { return callbacks_.size(); }
+    int getWorkerCount() const { return workerCount_; }
+
+private:
+    struct Job {
+        Ticket ticket;
+        Priority priority;
+        Vec2 start;
+        Vec2 goal;
+        PathfindingSystem::SearchMode mode;
+        std::shared_ptr<const Grid> snapshot;
+        uint64_t generation;  // which setGrid() the snapshot was taken from
+    };
+    // Heap order: higher priority first, then older tickets first
+    struct JobOrder {
+        bool operator()(const Job& a, const Job& b) const {
+            if (a.priority != b.priority) return a.priority < b.priority;
+            return a.ticket > b.ticket;
+        }
+    };
+    void startWorkers();
+    void workerLoop();
+
+    int workerCount_;
+    std::vector<std::thread> workers_;
+    const Grid* grid_ = nullptr;
+    std::shared_ptr<const Grid> snapshot_;
+    uint64_t generation_ = 0;
+    Ticket nextTicket_ = 1;
+    std::unordered_map<Ticket, Callback> callbacks_;  // main thread only
+
+    // Shared with the workers, guarded by mutex_
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable idle_;
+    std::vector<Job> jobs_;                  // heap ordered by JobOrder
+    std::unordered_set<Ticket> queued_;      // tickets in jobs_ not yet cancelled
+    std::vector<Result> finished_;
+    int running_ = 0;
+    bool stopping_ = false;
+};
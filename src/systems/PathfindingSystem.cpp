@@ -1,5 +1,4 @@
 #include "../systems/PathfindingSystem.hpp"
-#include <queue>
 #include <vector>
 #include <algorithm>
 #include <cmath>
@@ -8,8 +7,31 @@
 PathfindingSystem::PathfindingSystem() : grid_(nullptr) {}
 void PathfindingSystem::initialize(int cols, int rows, float tileSize) {
     grid_ = std::make_unique<Grid>(cols, rows, tileSize);
+    hierarchy_.reset();
+    // Revisions restart with the new grid, so nothing cached can be trusted
+    clearCache();
 }
-std::vector<Vec2> PathfindingSystem::findPath(const Vec2& start, const Vec2& goal) {
+void PathfindingSystem::loadGrid(const Grid& grid) {
+    if (!grid_ || grid_->getWidth() != grid.getWidth() || grid_->getHeight() != grid.getHeight() ||
+        grid.getRevision() < grid_->getRevision()) {
+        initialize(grid.getWidth(), grid.getHeight(), grid.getCellSize());
+    }
+    // Assigned in place: the hierarchy holds a reference to *grid_
+    *grid_ = grid;
+}
+void PathfindingSystem::setClusterSize(int clusterSize) {
+    if (clusterSize == clusterSize_) return;
+    clusterSize_ = clusterSize;
+    hierarchy_.reset();
+}
+HierarchicalPathfinder* PathfindingSystem::getHierarchy() {
+    if (!hierarchy_ && grid_) hierarchy_ = std::make_unique<HierarchicalPathfinder>(*grid_, clusterSize_);
+    return hierarchy_.get();
+}
+void PathfindingSystem::buildHierarchy() {
+    if (HierarchicalPathfinder* hierarchy = getHierarchy()) hierarchy->update();
+}
+std::vector<Vec2> PathfindingSystem::findPath(const Vec2& start, const Vec2& goal, SearchMode mode) {
     if (!grid_) return {};
     sf::Vector2i startGrid = grid_->worldToGrid(start);
     sf::Vector2i goalGrid = grid_->worldToGrid(goal);
@@ -21,66 +43,349 @@ std::vector<Vec2> PathfindingSystem::findPath(const Vec2& start, const Vec2& goa
     if (startGrid == goalGrid) {
         return { start, goal };
     }
-    auto nodeCompare = [](const Node* a, const Node* b) { return a->f > b->f; };
-    std::priority_queue<Node*, std::vector<Node*>, decltype(nodeCompare)> openList(nodeCompare);
-    std::vector<std::vector<Node*>> nodes(grid_->getHeight(), std::vector<Node*>(grid_->getWidth(), nullptr));
-    Node* startNode = new Node(startGrid.x, startGrid.y);
-    startNode->h = heuristic(startGrid.x, startGrid.y, goalGrid.x, goalGrid.y);
-    startNode->f = startNode->g + startNode->h;
-    nodes[startGrid.y][startGrid.x] = startNode;
-    openList.push(startNode);
-    while (!openList.empty()) {
-        Node* current = openList.top();
-        openList.pop();
-        if (current->x == goalGrid.x && current->y == goalGrid.y) {
-            std::vector<Vec2> path = reconstructPath(current);
-            // PHASE 3: Store for debugging
-            lastPath_ = path;
-            // Cleanup
-            for (int y = 0; y < grid_->getHeight(); ++y) {
-                for (int x = 0; x < grid_->getWidth(); ++x) {
-                    delete nodes[y][x];
-                }
-            }   
-            // PHASE 3: Apply smoothing
-            lastSmoothedPath_ = smoothPath(path);
-            return lastSmoothedPath_;
+    const int width = grid_->getWidth();
+    const int startCell = startGrid.y * width + startGrid.x;
+    const int goalCell = goalGrid.y * width + goalGrid.x;
+    const uint64_t cellCount = static_cast<uint64_t>(width) * grid_->getHeight();
+    const uint64_t key = (static_cast<uint64_t>(startCell) * cellCount + goalCell) * 3 + static_cast<uint64_t>(mode);
+    if (const CachedPath* cached = lookupCache(key, startGrid, goalGrid)) {
+        if (!cached->found) return {};
+        lastPath_ = cached->rawPath;
+        lastSmoothedPath_ = cached->smoothed;
+        return lastSmoothedPath_;
+    }
+    cacheStats_.misses++;
+    CachedPath entry;
+    entry.key = key;
+    entry.cost = 0.0f;
+    std::vector<Vec2> path;
+    if (mode == SearchMode::HIERARCHICAL) {
+        HierarchicalPathfinder* hierarchy = getHierarchy();
+        entry.found = hierarchy->findPath(startCell, goalCell, entry.cells, &entry.cost);
+        lastExpansions_ = hierarchy->getLastExpansions();
+        for (int cell : entry.cells) path.push_back(grid_->gridToWorld(cell % width, cell / width));
+        entry.cells.clear();
+    } else {
+        beginSearch();
+        lastExpansions_ = 0;
+        entry.found = mode == SearchMode::JUMP_POINT ? searchJumpPoint(startCell, goalCell)
+                                                     : searchAStar(startCell, goalCell);
+        if (entry.found) {
+            entry.cost = nodes_[goalCell].g;
+            path = reconstructPath(goalCell);
         }
-        // Check all 8 directions
+    }
+    if (!entry.found) {
+        // Failed searches are the most expensive ones; remember them too
+        storeInCache(std::move(entry));
+        return {};
+    }
+    // PHASE 3: Store for debugging
+    lastPath_ = path;
+    // PHASE 3: Apply smoothing
+    for (const Vec2& point : path) {
+        sf::Vector2i cell = grid_->worldToGrid(point);
+        entry.cells.push_back(cell.y * width + cell.x);
+    }
+    entry.simplified = simplifyPath(path);
+    lastSmoothedPath_ = entry.simplified.size() >= 4 ? catmullRomSpline(entry.simplified, 6) : entry.simplified;
+    entry.rawPath = std::move(path);
+    entry.smoothed = lastSmoothedPath_;
+    storeInCache(std::move(entry));
+    return lastSmoothedPath_;
+}
+bool PathfindingSystem::searchAStar(int startCell, int goalCell) {
+    const int width = grid_->getWidth();
+    const int goalX = goalCell % width;
+    const int goalY = goalCell / width;
+    SearchNode& startNode = touch(startCell);
+    startNode.f = heuristic(startCell % width, startCell / width, goalX, goalY);
+    heapPush(startCell);
+    while (!openHeap_.empty()) {
+        int cell = heapPop();
+        lastExpansions_++;
+        if (cell == goalCell) return true;
+        SearchNode& current = nodes_[cell];
+        current.closed = true;
+        int cx = cell % width;
+        int cy = cell / width;
+        // Check all 8 directions against one read of the 3x3 block
+        uint32_t neighborhood = grid_->neighborhood(cx, cy);
         for (int dy = -1; dy <= 1; ++dy) {
             for (int dx = -1; dx <= 1; ++dx) {
                 if (dx == 0 && dy == 0) continue;
-                int nx = current->x + dx;
-                int ny = current->y + dy;
-                if (!grid_->isWalkable(nx, ny)) continue;
-                Node* neighbor = nodes[ny][nx];
-                if (!neighbor) {
-                    neighbor = new Node(nx, ny);
-                    nodes[ny][nx] = neighbor;
-                }
+                if (!Grid::isOpen(neighborhood, dx, dy)) continue;
+                int nx = cx + dx;
+                int ny = cy + dy;
                 // Diagonal cost is sqrt(2), straight cost is 1
                 float cost = (dx != 0 && dy != 0) ? 1.414f : 1.0f;
-                float tentativeG = current->g + cost;
-                if (tentativeG < neighbor->g || neighbor->g == 0) {
-                    neighbor->parent = current;
-                    neighbor->g = tentativeG;
-                    neighbor->h = heuristic(nx, ny, goalGrid.x, goalGrid.y);
-                    neighbor->f = neighbor->g + neighbor->h;
-                    openList.push(neighbor);
-                }
+                relax(cell, ny * width + nx, current.g + cost, goalX, goalY);
             }
         }
     }
-    // Cleanup if no path found
-    for (int y = 0; y < grid_->getHeight(); ++y) {
-        for (int x = 0; x < grid_->getWidth(); ++x) {
-            delete nodes[y][x];
+    return false;
+}
+bool PathfindingSystem::searchJumpPoint(int startCell, int goalCell) {
+    const int width = grid_->getWidth();
+    const int goalX = goalCell % width;
+    const int goalY = goalCell / width;
+    SearchNode& startNode = touch(startCell);
+    startNode.f = heuristic(startCell % width, startCell / width, goalX, goalY);
+    heapPush(startCell);
+    int directions[8][2];
+    while (!openHeap_.empty()) {
+        int cell = heapPop();
+        lastExpansions_++;
+        if (cell == goalCell) return true;
+        SearchNode& current = nodes_[cell];
+        current.closed = true;
+        int cx = cell % width;
+        int cy = cell / width;
+        int count = prunedDirections(cell, directions);
+        for (int i = 0; i < count; ++i) {
+            int jumpCell = jump(cx, cy, directions[i][0], directions[i][1], goalX, goalY);
+            if (jumpCell < 0) continue;
+            // Runs are straight or diagonal, so the octile distance is the run's cost
+            int dx = std::abs(jumpCell % width - cx);
+            int dy = std::abs(jumpCell / width - cy);
+            float cost = 1.414f * std::min(dx, dy) + std::abs(dx - dy);
+            relax(cell, jumpCell, current.g + cost, goalX, goalY);
         }
-    }   
-    return {};
+    }
+    return false;
+}
+void PathfindingSystem::relax(int fromCell, int toCell, float g, int goalX, int goalY) {
+    bool discovered = nodes_[toCell].epoch != epoch_;
+    SearchNode& node = touch(toCell);
+    if (node.closed) return;
+    if (discovered || g < node.g) {
+        const int width = grid_->getWidth();
+        node.parent = fromCell;
+        node.g = g;
+        node.f = g + heuristic(toCell % width, toCell / width, goalX, goalY);
+        if (node.heapIndex < 0) heapPush(toCell);
+        else heapSiftUp(node.heapIndex);  // decrease-key
+    }
+}
+// Directions worth jumping in from a cell, given the direction it was reached
+// from: the natural continuations plus any forced by an obstacle alongside.
+// The start cell tries all eight.
+int PathfindingSystem::prunedDirections(int cell, int (&out)[8][2]) const {
+    const int width = grid_->getWidth();
+    int x = cell % width;
+    int y = cell / width;
+    int parent = nodes_[cell].parent;
+    int count = 0;
+    auto add = [&](int dx, int dy) {
+        out[count][0] = dx;
+        out[count][1] = dy;
+        count++;
+    };
+    if (parent < 0) {
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dx = -1; dx <= 1; ++dx) {
+                if (dx != 0 || dy != 0) add(dx, dy);
+            }
+        }
+        return count;
+    }
+    int px = parent % width;
+    int py = parent / width;
+    int dx = (x > px) - (x < px);
+    int dy = (y > py) - (y < py);
+    uint32_t neighborhood = grid_->neighborhood(x, y);
+    if (dx != 0 && dy != 0) {
+        add(dx, 0);
+        add(0, dy);
+        add(dx, dy);
+        if (!Grid::isOpen(neighborhood, -dx, 0)) add(-dx, dy);
+        if (!Grid::isOpen(neighborhood, 0, -dy)) add(dx, -dy);
+    } else if (dx != 0) {
+        add(dx, 0);
+        if (!Grid::isOpen(neighborhood, 0, 1)) add(dx, 1);
+        if (!Grid::isOpen(neighborhood, 0, -1)) add(dx, -1);
+    } else {
+        add(0, dy);
+        if (!Grid::isOpen(neighborhood, 1, 0)) add(1, dy);
+        if (!Grid::isOpen(neighborhood, -1, 0)) add(-1, dy);
+    }
+    return count;
+}
+// Walks from (x, y) in direction (dx, dy) until it hits a wall (-1), the goal,
+// or a cell with a forced neighbour. Diagonal runs also stop where a straight
+// run branching off them would.
+int PathfindingSystem::jump(int x, int y, int dx, int dy, int goalX, int goalY) const {
+    const int width = grid_->getWidth();
+    while (true) {
+        x += dx;
+        y += dy;
+        if (!grid_->isWalkable(x, y)) return -1;
+        int cell = y * width + x;
+        if (x == goalX && y == goalY) return cell;
+        uint32_t n = grid_->neighborhood(x, y);
+        auto open = [n](int ox, int oy) { return Grid::isOpen(n, ox, oy); };
+        if (dx != 0 && dy != 0) {
+            if ((!open(-dx, 0) && open(-dx, dy)) || (!open(0, -dy) && open(dx, -dy))) return cell;
+            if (jump(x, y, dx, 0, goalX, goalY) >= 0 || jump(x, y, 0, dy, goalX, goalY) >= 0) return cell;
+        } else if (dx != 0) {
+            if ((!open(0, 1) && open(dx, 1)) || (!open(0, -1) && open(dx, -1))) return cell;
+        } else {
+            if ((!open(1, 0) && open(1, dy)) || (!open(-1, 0) && open(-1, dy))) return cell;
+        }
+    }
+}
+void PathfindingSystem::setCacheCapacity(size_t capacity) {
+    cacheCapacity_ = capacity;
+    while (cache_.size() > cacheCapacity_) {
+        cacheIndex_.erase(cache_.back().key);
+        cache_.pop_back();
+    }
+}
+void PathfindingSystem::clearCache() {
+    cache_.clear();
+    cacheIndex_.clear();
+}
+const PathfindingSystem::CachedPath* PathfindingSystem::lookupCache(uint64_t key, const sf::Vector2i& start, const sf::Vector2i& goal) {
+    auto it = cacheIndex_.find(key);
+    if (it == cacheIndex_.end()) return nullptr;
+    if (!revalidate(*it->second, start, goal)) {
+        cache_.erase(it->second);
+        cacheIndex_.erase(it);
+        cacheStats_.invalidations++;
+        return nullptr;
+    }
+    cache_.splice(cache_.begin(), cache_, it->second);
+    cacheStats_.hits++;
+    return &cache_.front();
+}
+bool PathfindingSystem::revalidate(CachedPath& entry, const sf::Vector2i& start, const sf::Vector2i& goal) const {
+    const uint64_t revision = grid_->getRevision();
+    if (entry.revision == revision) return true;
+    const int width = grid_->getWidth();
+    // Cheapest possible 8-way route through a cell; opening a cell can only
+    // help if a route through it could undercut the cached cost
+    auto octile = [](int x1, int y1, int x2, int y2) {
+        int dx = std::abs(x1 - x2);
+        int dy = std::abs(y1 - y2);
+        return 1.414f * std::min(dx, dy) + std::abs(dx - dy);
+    };
+    bool valid = true;
+    bool anyBlocked = false;
+    bool journaled = grid_->forEachChangeSince(entry.revision, [&](const Grid::CellChange& change) {
+        if (!valid) return;
+        if (change.walkable) {
+            if (!entry.found || octile(start.x, start.y, change.x, change.y) +
+                                octile(change.x, change.y, goal.x, goal.y) < entry.cost - 0.001f) {
+                valid = false;
+            }
+        } else {
+            anyBlocked = true;
+        }
+    });
+    if (!journaled) return false;
+    // A blocked cell only matters if the route or a smoothed shortcut crosses it
+    if (valid && anyBlocked && entry.found) {
+        for (int cell : entry.cells) {
+            if (!grid_->isWalkable(cell % width, cell / width)) return false;
+        }
+        for (size_t i = 0; i + 1 < entry.simplified.size(); ++i) {
+            if (!lineOfSight(entry.simplified[i], entry.simplified[i + 1])) return false;
+        }
+    }
+    if (valid) entry.revision = revision;
+    return valid;
+}
+void PathfindingSystem::storeInCache(CachedPath entry) {
+    if (cacheCapacity_ == 0) return;
+    entry.revision = grid_->getRevision();
+    auto existing = cacheIndex_.find(entry.key);
+    if (existing != cacheIndex_.end()) {
+        cache_.erase(existing->second);
+        cacheIndex_.erase(existing);
+    }
+    cache_.push_front(std::move(entry));
+    cacheIndex_[cache_.front().key] = cache_.begin();
+    if (cache_.size() > cacheCapacity_) {
+        cacheIndex_.erase(cache_.back().key);
+        cache_.pop_back();
+    }
+}
+void PathfindingSystem::beginSearch() {
+    size_t cellCount = static_cast<size_t>(grid_->getWidth()) * grid_->getHeight();
+    if (nodes_.size() != cellCount) {
+        nodes_.assign(cellCount, SearchNode());
+        openHeap_.reserve(cellCount);
+        epoch_ = 0;
+    }
+    openHeap_.clear();
+    // On wrap-around, stale stamps could collide with the new epoch
+    if (++epoch_ == 0) {
+        for (auto& node : nodes_) node.epoch = 0;
+        epoch_ = 1;
+    }
+}
+PathfindingSystem::SearchNode& PathfindingSystem::touch(int cell) {
+    SearchNode& node = nodes_[cell];
+    if (node.epoch != epoch_) {
+        node.g = 0.0f;
+        node.f = 0.0f;
+        node.parent = -1;
+        node.heapIndex = -1;
+        node.closed = false;
+        node.epoch = epoch_;
+    }
+    return node;
+}
+void PathfindingSystem::heapPush(int cell) {
+    openHeap_.push_back(cell);
+    nodes_[cell].heapIndex = static_cast<int>(openHeap_.size()) - 1;
+    heapSiftUp(nodes_[cell].heapIndex);
+}
+int PathfindingSystem::heapPop() {
+    int top = openHeap_.front();
+    heapSwap(0, static_cast<int>(openHeap_.size()) - 1);
+    openHeap_.pop_back();
+    nodes_[top].heapIndex = -1;
+    if (!openHeap_.empty()) heapSiftDown(0);
+    return top;
+}
+void PathfindingSystem::heapSiftUp(int index) {
+    while (index > 0) {
+        int parent = (index - 1) / 2;
+        if (nodes_[openHeap_[parent]].f <= nodes_[openHeap_[index]].f) break;
+        heapSwap(index, parent);
+        index = parent;
+    }
+}
+void PathfindingSystem::heapSiftDown(int index) {
+    const int size = static_cast<int>(openHeap_.size());
+    while (true) {
+        int smallest = index;
+        int left = index * 2 + 1;
+        int right = left + 1;
+        if (left < size && nodes_[openHeap_[left]].f < nodes_[openHeap_[smallest]].f) smallest = left;
+        if (right < size && nodes_[openHeap_[right]].f < nodes_[openHeap_[smallest]].f) smallest = right;
+        if (smallest == index) break;
+        heapSwap(index, smallest);
+        index = smallest;
+    }
+}
+void PathfindingSystem::heapSwap(int a, int b) {
+    std::swap(openHeap_[a], openHeap_[b]);
+    nodes_[openHeap_[a]].heapIndex = a;
+    nodes_[openHeap_[b]].heapIndex = b;
 }
 // PHASE 3: Enhanced path smoothing
 std::vector<Vec2> PathfindingSystem::smoothPath(const std::vector<Vec2>& path) {
+    if (path.size() < 3) return path;
+    std::vector<Vec2> simplified = simplifyPath(path);
+    // Second pass: Apply Catmull-Rom spline for smooth curves
+    if (simplified.size() >= 4) {
+        return catmullRomSpline(simplified, 6);
+    }   
+    return simplified;
+}
+std::vector<Vec2> PathfindingSystem::simplifyPath(const std::vector<Vec2>& path) const {
     if (path.size() < 3) return path;
     // First pass: Remove unnecessary points using line-of-sight
     std::vector<Vec2> simplified;
@@ -98,16 +403,13 @@ std::vector<Vec2> PathfindingSystem::smoothPath(const std::vector<Vec2>& path) {
         simplified.push_back(path[furthestVisible]);
         currentIndex = furthestVisible;
     }
-    // Second pass: Apply Catmull-Rom spline for smooth curves
-    if (simplified.size() >= 4) {
-        return catmullRomSpline(simplified, 6);
-    }   
     return simplified;
 }
 // PHASE 3: Catmull-Rom spline interpolation
 std::vector<Vec2> PathfindingSystem::catmullRomSpline(const std::vector<Vec2>& points, int segments) {
     if (points.size() < 4) return points;
     std::vector<Vec2> smoothed;
+    smoothed.reserve((points.size() - 3) * segments + 2);
     smoothed.push_back(points[0]);
     for (size_t i = 0; i < points.size() - 3; ++i) {
         const Vec2& p0 = points[i];
@@ -174,10 +476,13 @@ Vec2 PathfindingSystem::getInterpolatedPosition(const std::vector<Vec2>& path, f
     }   
     return path.back();
 }
+Vec2 PathfindingSystem::getInterpolatedPosition(const PathRoute& route, float progress) const {
+    return route.positionAt(progress * route.totalLength());
+}
 // PHASE 3: Calculate total path length
 float PathfindingSystem::getPathLength(const std::vector<Vec2>& path) const {
     float length = 0.0f;
-    for (size_t i = 0; i < path.size() - 1; ++i) {
+    for (size_t i = 0; i + 1 < path.size(); ++i) {
         Vec2 segment = path[i + 1] - path[i];
         length += std::sqrt(segment.x * segment.x + segment.y * segment.y);
     }
@@ -187,27 +492,7 @@ bool PathfindingSystem::lineOfSight(const Vec2& a, const Vec2& b) const {
     if (!grid_) return false;
     sf::Vector2i start = grid_->worldToGrid(a);
     sf::Vector2i end = grid_->worldToGrid(b);
-    int dx = std::abs(end.x - start.x);
-    int dy = std::abs(end.y - start.y);
-    int sx = (start.x < end.x) ? 1 : -1;
-    int sy = (start.y < end.y) ? 1 : -1;
-    int err = dx - dy;
-    int x = start.x;
-    int y = start.y;
-    while (true) {
-        if (!grid_->isWalkable(x, y)) return false;
-        if (x == end.x && y == end.y) break;
-        int e2 = 2 * err;
-        if (e2 > -dy) {
-            err -= dy;
-            x += sx;
-        }
-        if (e2 < dx) {
-            err += dx;
-            y += sy;
-        }
-    }
-    return true;
+    return grid_->isLineWalkable(start.x, start.y, end.x, end.y);
 }
 float PathfindingSystem::heuristic(int x1, int y1, int x2, int y2) const {
     // Use Euclidean distance for more natural paths
@@ -215,13 +500,24 @@ float PathfindingSystem::heuristic(int x1, int y1, int x2, int y2) const {
     float dy = static_cast<float>(y1 - y2);
     return std::sqrt(dx * dx + dy * dy);
 }
-std::vector<Vec2> PathfindingSystem::reconstructPath(Node* endNode) const {
+std::vector<Vec2> PathfindingSystem::reconstructPath(int endCell) const {
     if (!grid_) return {};
     std::vector<Vec2> path;
-    Node* current = endNode;
-    while (current) {
-        path.push_back(grid_->gridToWorld(current->x, current->y));
-        current = current->parent;
+    const int width = grid_->getWidth();
+    for (int cell = endCell; cell >= 0; cell = nodes_[cell].parent) {
+        int x = cell % width;
+        int y = cell / width;
+        path.push_back(grid_->gridToWorld(x, y));
+        int parent = nodes_[cell].parent;
+        if (parent < 0) break;
+        // Jump point parents sit a whole run away; fill in the cells between
+        int px = parent % width;
+        int py = parent / width;
+        int sx = (px > x) - (px < x);
+        int sy = (py > y) - (py < y);
+        for (x += sx, y += sy; x != px || y != py; x += sx, y += sy) {
+            path.push_back(grid_->gridToWorld(x, y));
+        }
     }
     std::reverse(path.begin(), path.end());
     return path;
@@ -2,35 +2,120 @@
 #include <SFML/System/Vector2.hpp>
 #include <vector>
 #include <memory>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
 #include "../systems/Grid.hpp"
+#include "../systems/HierarchicalPathfinder.hpp"
+#include "../systems/PathRegistry.hpp"
 using Vec2 = sf::Vector2f;
-struct Node {
-    int x, y;
-    float f, g, h;
-    Node* parent;
-    Node(int x = 0, int y = 0) : x(x), y(y), f(0), g(0), h(0), parent(nullptr) {}
-};
 class PathfindingSystem {
 public:
     PathfindingSystem();
     void initialize(int cols, int rows, float tileSize);
-    std::vector<Vec2> findPath(const Vec2& start, const Vec2& goal);
+    // ASTAR expands every neighbour. JUMP_POINT (jump point search) runs along
+    // straight and diagonal lines and only queues cells with forced neighbours;
+    // it uses the same 8-way moves and costs, so routes are just as short.
+    // HIERARCHICAL searches the HPA* entrance graph and refines it cluster by
+    // cluster; for big maps, at the price of slightly longer routes.
+    enum class SearchMode { ASTAR, JUMP_POINT, HIERARCHICAL };
+    std::vector<Vec2> findPath(const Vec2& start, const Vec2& goal, SearchMode mode = SearchMode::ASTAR);
+    // Nodes popped from the open list by the last search that wasn't a cache hit
+    size_t getLastExpansions() const { return lastExpansions_; }
+    // Cluster edge length for HIERARCHICAL; the graph is built on first use
+    void setClusterSize(int clusterSize);
+    HierarchicalPathfinder* getHierarchy();
+    // Builds the HPA* graph now rather than inside the first HIERARCHICAL
+    // search (seconds on a 1024x1024 grid); later edits are applied
+    // incrementally either way
+    void buildHierarchy();
     // PHASE 3: Enhanced path smoothing
     std::vector<Vec2> smoothPath(const std::vector<Vec2>& path);
+    // Line-of-sight pass of smoothPath: drops waypoints that can be skipped
+    std::vector<Vec2> simplifyPath(const std::vector<Vec2>& path) const;
     std::vector<Vec2> catmullRomSpline(const std::vector<Vec2>& points, int segments = 4);
     std::vector<Vec2> bezierCurve(const std::vector<Vec2>& points, int segments = 4);
     bool lineOfSight(const Vec2& a, const Vec2& b) const;
     float heuristic(int x1, int y1, int x2, int y2) const;
-    std::vector<Vec2> reconstructPath(Node* endNode) const;
-    // PHASE 3: Helper methods for smooth movement
+    std::vector<Vec2> reconstructPath(int endCell) const;
+    // PHASE 3: Helper methods for smooth movement. The vector forms walk the
+    // whole path per call; the PathRoute form is a binary search in its
+    // precomputed arc-length table. progress runs 0..1 over the path.
     Vec2 getInterpolatedPosition(const std::vector<Vec2>& path, float progress) const;
+    Vec2 getInterpolatedPosition(const PathRoute& route, float progress) const;
     float getPathLength(const std::vector<Vec2>& path) const;
     // PHASE 3: Debug visualization
     std::vector<Vec2> getLastPath() const { return lastPath_; }
     std::vector<Vec2> getLastSmoothedPath() const { return lastSmoothedPath_; }
+    Grid* getGrid() { return grid_.get(); }
+    // Copies in a snapshot that continues this grid's edit history (same map,
+    // same size, revision not older). Cached routes and the hierarchy catch
+    // up through the copied journal; anything else starts over.
+    void loadGrid(const Grid& grid);
+    // findPath results are kept in an LRU cache keyed by (start cell, goal cell).
+    // Grid edits don't flush it: a hit is checked against the edits journaled
+    // since it was stored, and dropped only if one could change the answer.
+    struct CacheStats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t invalidations = 0;
+    };
+    const CacheStats& getCacheStats() const { return cacheStats_; }
+    void resetCacheStats() { cacheStats_ = CacheStats(); }
+    void setCacheCapacity(size_t capacity);  // 0 disables caching
+    void clearCache();
 private:
+    struct CachedPath {
+        uint64_t key;
+        uint64_t revision;              // grid revision the entry is known good at
+        bool found;
+        float cost;                     // raw route cost in cells
+        std::vector<int> cells;         // raw route, as cell indices
+        std::vector<Vec2> rawPath;
+        std::vector<Vec2> simplified;   // waypoints the smoothing was built on
+        std::vector<Vec2> smoothed;
+    };
+    const CachedPath* lookupCache(uint64_t key, const sf::Vector2i& start, const sf::Vector2i& goal);
+    bool revalidate(CachedPath& entry, const sf::Vector2i& start, const sf::Vector2i& goal) const;
+    void storeInCache(CachedPath entry);
+
+    // A* search state, one entry per grid cell, reused across queries.
+    // A cell whose epoch differs from epoch_ is untouched in the current search,
+    // so starting a new search is a counter bump rather than a clear.
+    struct SearchNode {
+        float g = 0.0f;
+        float f = 0.0f;
+        int parent = -1;
+        int heapIndex = -1;   // position in openHeap_, -1 when not queued
+        uint32_t epoch = 0;
+        bool closed = false;
+    };
+    bool searchAStar(int startCell, int goalCell);
+    bool searchJumpPoint(int startCell, int goalCell);
+    void relax(int fromCell, int toCell, float g, int goalX, int goalY);
+    int prunedDirections(int cell, int (&out)[8][2]) const;
+    int jump(int x, int y, int dx, int dy, int goalX, int goalY) const;
+    void beginSearch();
+    SearchNode& touch(int cell);
+    // Indexed binary min-heap on f over openHeap_ (cell indices)
+    void heapPush(int cell);
+    int heapPop();
+    void heapSiftUp(int index);
+    void heapSiftDown(int index);
+    void heapSwap(int a, int b);
+
     std::unique_ptr<Grid> grid_;
+    std::unique_ptr<HierarchicalPathfinder> hierarchy_;
+    int clusterSize_ = 32;
+    std::vector<SearchNode> nodes_;
+    std::vector<int> openHeap_;
+    uint32_t epoch_ = 0;
+    size_t lastExpansions_ = 0;
     // PHASE 3: Store last paths for debugging
     std::vector<Vec2> lastPath_;
     std::vector<Vec2> lastSmoothedPath_;
+    std::list<CachedPath> cache_;  // most recently used first
+    std::unordered_map<uint64_t, std::list<CachedPath>::iterator> cacheIndex_;
+    size_t cacheCapacity_ = 64;
+    CacheStats cacheStats_;
 };
\ No newline at end of file
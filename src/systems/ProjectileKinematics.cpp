@@ -0,0 +1,217 @@
+#include "../systems/ProjectileKinematics.hpp"
+#include <cmath>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define PROJECTILE_KERNEL_SSE2 1
+#include <emmintrin.h>
+#endif
+// AVX2 is picked at run time, so a default x86-64 build still uses it
+#if PROJECTILE_KERNEL_SSE2 && defined(__GNUC__)
+#define PROJECTILE_KERNEL_AVX2 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// Raw views of the arrays for the kernels
+struct Lanes {
+    float *x, *y, *prevX, *prevY, *vx, *vy, *speed, *distance, *maxDistance;
+    float *rotation, *rotationSpeed, *trailTimer, *trailInterval;
+    float minX, minY, maxX, maxY;
+};
+
+Lanes lanesOf(ProjectileKinematics& k) {
+    return Lanes{k.x.data(), k.y.data(), k.prevX.data(), k.prevY.data(), k.vx.data(), k.vy.data(),
+                 k.speed.data(), k.distance.data(), k.maxDistance.data(), k.rotation.data(),
+                 k.rotationSpeed.data(), k.trailTimer.data(), k.trailInterval.data(),
+                 k.minX, k.minY, k.maxX, k.maxY};
+}
+
+void pushLanes(int mask, int lanes, size_t base, std::vector<uint32_t>& out) {
+    for (int bit = 0; bit < lanes; ++bit) {
+        if (mask & (1 << bit)) out.push_back(static_cast<uint32_t>(base + bit));
+    }
+}
+
+// Reference version; the vector kernels do exactly these operations per lane.
+// Spins and Trails compile out the rotation and trail-timer work.
+template<bool Spins, bool Trails>
+void stepScalar(const Lanes& l, size_t begin, size_t end, float dt,
+                std::vector<uint32_t>& expired, std::vector<uint32_t>& trails) {
+    for (size_t i = begin; i < end; ++i) {
+        l.prevX[i] = l.x[i];
+        l.prevY[i] = l.y[i];
+        float px = l.x[i] + l.vx[i] * dt;
+        float py = l.y[i] + l.vy[i] * dt;
+        float travelled = l.distance[i] + l.speed[i] * dt;
+        l.x[i] = px;
+        l.y[i] = py;
+        l.distance[i] = travelled;
+        if constexpr (Spins) l.rotation[i] = l.rotation[i] + l.rotationSpeed[i] * dt;
+        bool out = px < l.minX || px > l.maxX || py < l.minY || py > l.maxY || travelled > l.maxDistance[i];
+        if (out) expired.push_back(static_cast<uint32_t>(i));
+        if constexpr (Trails) {
+            float timer = l.trailTimer[i] + dt;
+            bool due = !out && timer >= l.trailInterval[i];
+            l.trailTimer[i] = due ? 0.f : timer;
+            if (due) trails.push_back(static_cast<uint32_t>(i));
+        }
+    }
+}
+
+#if PROJECTILE_KERNEL_SSE2
+template<bool Spins, bool Trails>
+size_t stepSse2(const Lanes& l, size_t begin, size_t end, float dt,
+                std::vector<uint32_t>& expired, std::vector<uint32_t>& trails) {
+    const __m128 step = _mm_set1_ps(dt);
+    const __m128 minX = _mm_set1_ps(l.minX), maxX = _mm_set1_ps(l.maxX);
+    const __m128 minY = _mm_set1_ps(l.minY), maxY = _mm_set1_ps(l.maxY);
+    size_t i = begin;
+    for (; i + 4 <= end; i += 4) {
+        __m128 px = _mm_loadu_ps(l.x + i);
+        __m128 py = _mm_loadu_ps(l.y + i);
+        _mm_storeu_ps(l.prevX + i, px);
+        _mm_storeu_ps(l.prevY + i, py);
+        px = _mm_add_ps(px, _mm_mul_ps(_mm_loadu_ps(l.vx + i), step));
+        py = _mm_add_ps(py, _mm_mul_ps(_mm_loadu_ps(l.vy + i), step));
+        __m128 travelled = _mm_add_ps(_mm_loadu_ps(l.distance + i), _mm_mul_ps(_mm_loadu_ps(l.speed + i), step));
+        _mm_storeu_ps(l.x + i, px);
+        _mm_storeu_ps(l.y + i, py);
+        _mm_storeu_ps(l.distance + i, travelled);
+        if constexpr (Spins) {
+            _mm_storeu_ps(l.rotation + i, _mm_add_ps(_mm_loadu_ps(l.rotation + i),
+                                                     _mm_mul_ps(_mm_loadu_ps(l.rotationSpeed + i), step)));
+        }
+        __m128 out = _mm_or_ps(_mm_or_ps(_mm_cmplt_ps(px, minX), _mm_cmpgt_ps(px, maxX)),
+                               _mm_or_ps(_mm_cmplt_ps(py, minY), _mm_cmpgt_ps(py, maxY)));
+        out = _mm_or_ps(out, _mm_cmpgt_ps(travelled, _mm_loadu_ps(l.maxDistance + i)));
+        int outMask = _mm_movemask_ps(out);
+        if (outMask) pushLanes(outMask, 4, i, expired);
+        if constexpr (Trails) {
+            __m128 timer = _mm_add_ps(_mm_loadu_ps(l.trailTimer + i), step);
+            __m128 due = _mm_andnot_ps(out, _mm_cmpge_ps(timer, _mm_loadu_ps(l.trailInterval + i)));
+            _mm_storeu_ps(l.trailTimer + i, _mm_andnot_ps(due, timer));
+            int dueMask = _mm_movemask_ps(due);
+            if (dueMask) pushLanes(dueMask, 4, i, trails);
+        }
+    }
+    return i;
+}
+#endif
+
+#if PROJECTILE_KERNEL_AVX2
+template<bool Spins, bool Trails>
+__attribute__((target("avx2")))
+size_t stepAvx2(const Lanes& l, size_t begin, size_t end, float dt,
+                std::vector<uint32_t>& expired, std::vector<uint32_t>& trails) {
+    const __m256 step = _mm256_set1_ps(dt);
+    const __m256 minX = _mm256_set1_ps(l.minX), maxX = _mm256_set1_ps(l.maxX);
+    const __m256 minY = _mm256_set1_ps(l.minY), maxY = _mm256_set1_ps(l.maxY);
+    size_t i = begin;
+    for (; i + 8 <= end; i += 8) {
+        __m256 px = _mm256_loadu_ps(l.x + i);
+        __m256 py = _mm256_loadu_ps(l.y + i);
+        _mm256_storeu_ps(l.prevX + i, px);
+        _mm256_storeu_ps(l.prevY + i, py);
+        px = _mm256_add_ps(px, _mm256_mul_ps(_mm256_loadu_ps(l.vx + i), step));
+        py = _mm256_add_ps(py, _mm256_mul_ps(_mm256_loadu_ps(l.vy + i), step));
+        __m256 travelled = _mm256_add_ps(_mm256_loadu_ps(l.distance + i),
+                                         _mm256_mul_ps(_mm256_loadu_ps(l.speed + i), step));
+        _mm256_storeu_ps(l.x + i, px);
+        _mm256_storeu_ps(l.y + i, py);
+        _mm256_storeu_ps(l.distance + i, travelled);
+        if constexpr (Spins) {
+            _mm256_storeu_ps(l.rotation + i, _mm256_add_ps(_mm256_loadu_ps(l.rotation + i),
+                                                           _mm256_mul_ps(_mm256_loadu_ps(l.rotationSpeed + i), step)));
+        }
+        __m256 out = _mm256_or_ps(_mm256_or_ps(_mm256_cmp_ps(px, minX, _CMP_LT_OQ), _mm256_cmp_ps(px, maxX, _CMP_GT_OQ)),
+                                  _mm256_or_ps(_mm256_cmp_ps(py, minY, _CMP_LT_OQ), _mm256_cmp_ps(py, maxY, _CMP_GT_OQ)));
+        out = _mm256_or_ps(out, _mm256_cmp_ps(travelled, _mm256_loadu_ps(l.maxDistance + i), _CMP_GT_OQ));
+        int outMask = _mm256_movemask_ps(out);
+        if (outMask) pushLanes(outMask, 8, i, expired);
+        if constexpr (Trails) {
+            __m256 timer = _mm256_add_ps(_mm256_loadu_ps(l.trailTimer + i), step);
+            __m256 due = _mm256_andnot_ps(out, _mm256_cmp_ps(timer, _mm256_loadu_ps(l.trailInterval + i), _CMP_GE_OQ));
+            _mm256_storeu_ps(l.trailTimer + i, _mm256_andnot_ps(due, timer));
+            int dueMask = _mm256_movemask_ps(due);
+            if (dueMask) pushLanes(dueMask, 8, i, trails);
+        }
+    }
+    return i;
+}
+
+bool cpuHasAvx2() {
+    static const bool hasAvx2 = __builtin_cpu_supports("avx2");
+    return hasAvx2;
+}
+#endif
+
+} // namespace
+
+void ProjectileKinematics::reserve(size_t count) {
+    for (auto* lane : {&x, &y, &prevX, &prevY, &vx, &vy, &speed, &distance, &maxDistance,
+                       &rotation, &rotationSpeed, &trailTimer, &trailInterval}) {
+        lane->reserve(count);
+    }
+    slot.reserve(count);
+}
+
+size_t ProjectileKinematics::push(uint32_t owner, const sf::Vector2f& position, const sf::Vector2f& velocity,
+                                  float range, float spin, float trailEvery) {
+    x.push_back(position.x);
+    y.push_back(position.y);
+    prevX.push_back(position.x);
+    prevY.push_back(position.y);
+    vx.push_back(velocity.x);
+    vy.push_back(velocity.y);
+    speed.push_back(std::sqrt(velocity.x * velocity.x + velocity.y * velocity.y));
+    distance.push_back(0.f);
+    maxDistance.push_back(range);
+    rotation.push_back(0.f);
+    rotationSpeed.push_back(spin);
+    trailTimer.push_back(0.f);
+    trailInterval.push_back(trailEvery > 0.f ? trailEvery : std::numeric_limits<float>::infinity());
+    slot.push_back(owner);
+    return x.size() - 1;
+}
+
+void ProjectileKinematics::remove(size_t position) {
+    for (auto* lane : {&x, &y, &prevX, &prevY, &vx, &vy, &speed, &distance, &maxDistance,
+                       &rotation, &rotationSpeed, &trailTimer, &trailInterval}) {
+        (*lane)[position] = lane->back();
+        lane->pop_back();
+    }
+    slot[position] = slot.back();
+    slot.pop_back();
+}
+
+void ProjectileKinematics::clear() {
+    for (auto* lane : {&x, &y, &prevX, &prevY, &vx, &vy, &speed, &distance, &maxDistance,
+                       &rotation, &rotationSpeed, &trailTimer, &trailInterval}) {
+        lane->clear();
+    }
+    slot.clear();
+}
+
+template<bool Spins, bool Trails>
+void ProjectileKinematics::step(float dt, std::vector<uint32_t>& expired, std::vector<uint32_t>& trails) {
+    expired.clear();
+    trails.clear();
+    const size_t count = size();
+    if (count == 0) return;
+    Lanes lanes = lanesOf(*this);
+    size_t done = 0;
+#if PROJECTILE_KERNEL_AVX2
+    if (cpuHasAvx2()) done = stepAvx2<Spins, Trails>(lanes, done, count, dt, expired, trails);
+#endif
+#if PROJECTILE_KERNEL_SSE2
+    done = stepSse2<Spins, Trails>(lanes, done, count, dt, expired, trails);
+#endif
+    stepScalar<Spins, Trails>(lanes, done, count, dt, expired, trails);
+}
+
+template void ProjectileKinematics::step<false, false>(float, std::vector<uint32_t>&, std::vector<uint32_t>&);
+template void ProjectileKinematics::step<false, true>(float, std::vector<uint32_t>&, std::vector<uint32_t>&);
+template void ProjectileKinematics::step<true, false>(float, std::vector<uint32_t>&, std::vector<uint32_t>&);
+template void ProjectileKinematics::step<true, true>(float, std::vector<uint32_t>&, std::vector<uint32_t>&);
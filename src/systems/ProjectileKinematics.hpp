@@ -0,0 +1,41 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <SFML/System/Vector2.hpp>
+// Hot per-projectile state as structure-of-arrays. Live projectiles occupy
+// [0, size()) of every array, so a tick is one straight sweep over packed
+// floats; remove() swap-removes to keep it that way.
+struct ProjectileKinematics {
+    std::vector<float> x, y;
+    std::vector<float> prevX, prevY;      // position before the last step, for interpolation
+    std::vector<float> vx, vy;            // direction * speed
+    std::vector<float> speed;             // |v|: distance covered per second
+    std::vector<float> distance, maxDistance;
+    std::vector<float> rotation, rotationSpeed;
+    std::vector<float> trailTimer, trailInterval;  // interval is +inf without a trail
+    std::vector<uint32_t> slot;           // the projectile's slot in ProjectileSystem's pool
+
+    // Projectiles leaving this box are retired
+    float minX = -100.f, minY = -100.f, maxX = 2000.f, maxY = 2000.f;
+
+    size_t size() const { return x.size(); }
+    void reserve(size_t count);
+    // Appends a projectile and returns its position
+    size_t push(uint32_t owner, const sf::Vector2f& position, const sf::Vector2f& velocity,
+                float range, float spin, float trailEvery);
+    // Moves the last projectile into position; the caller re-points its slot
+    void remove(size_t position);
+    void clear();
+    sf::Vector2f positionAt(size_t position) const { return sf::Vector2f(x[position], y[position]); }
+    sf::Vector2f previousAt(size_t position) const { return sf::Vector2f(prevX[position], prevY[position]); }
+
+    // One fused tick: moves every projectile, adds to its distance, spins it
+    // and runs its trail timer, then lists (ascending) the positions that left
+    // the box or their range, and the positions still flying whose trail is
+    // due (their timers restart). Runs 8 lanes at a time with AVX2 or 4 with
+    // SSE2 where the CPU has them; the scalar loop does the rest. Without
+    // Spins or Trails the kernels skip the rotation or trail lanes entirely.
+    template<bool Spins = true, bool Trails = true>
+    void step(float dt, std::vector<uint32_t>& expired, std::vector<uint32_t>& trails);
+};
@@ -1,85 +1,130 @@
 #include "../systems/ProjectileSystem.hpp"
+#include "../systems/ProjectileTraits.hpp"
 #include "../systems/EnemySystem.hpp"
 #include "../systems/ParticleSystem.hpp"
+#include "../systems/CollisionSystem.hpp"
 #include "../entities/Enemy.hpp"
 #include <cmath>
 #include <iostream>
-ProjectileSystem::ProjectileSystem(size_t poolSize)
-    : projectilePool_(poolSize), enemySystem_(nullptr), particleSystem_(nullptr) {
+#include <type_traits>
+#include <utility>
+ProjectileSystem::ProjectileSystem(size_t pageSize, size_t maxProjectiles)
+    : projectilePool_(pageSize, maxProjectiles), kinematicsIndex_(projectilePool_.capacity(), 0),
+      enemySystem_(nullptr), particleSystem_(nullptr), collisionSystem_(nullptr) {
 }
 void ProjectileSystem::initialize(EnemySystem* enemySystem, ParticleSystem* particleSystem) {
     enemySystem_ = enemySystem;
     particleSystem_ = particleSystem; // PHASE 3: Store particle system
 }
-void ProjectileSystem::spawn(const ProjectileInfo& projectile, const sf::Vector2f& position) {
+void ProjectileSystem::setCollisionSystem(CollisionSystem* collisionSystem) {
+    collisionSystem_ = collisionSystem;
+}
+namespace {
+template<typename Fn, int... Types>
+void forEachType(Fn&& fn, std::integer_sequence<int, Types...>) {
+    (fn(std::integral_constant<ProjectileData::Type, static_cast<ProjectileData::Type>(Types)>{}), ...);
+}
+// Calls fn(std::integral_constant<Type, T>) for every projectile type, so
+// fn can instantiate per-type code
+template<typename Fn>
+void forEachType(Fn&& fn) {
+    forEachType(fn, std::make_integer_sequence<int, ProjectileData::TypeCount>{});
+}
+// Family defaults, keyed on the texture name
+ProjectileArchetype archetypeFor(const std::string& texture) {
+    ProjectileArchetype archetype;
+    if (texture.find("fireball") != std::string::npos) {
+        archetype.type = ProjectileArchetype::FIREBALL;
+        archetype.trailInterval = 0.02f;
+        archetype.maxDistance = 800.f;
+        archetype.explosionRadius = 60.f;
+        archetype.rotationSpeed = 180.f; // Spinning fireball
+    } else if (texture.find("ice") != std::string::npos) {
+        archetype.type = ProjectileArchetype::ICE_SHARD;
+        archetype.trailInterval = 0.04f;
+        archetype.statusEffectType = 0; // Slow
+        archetype.statusDuration = 3.0f;
+        archetype.rotationSpeed = 90.f;
+    } else if (texture.find("poison") != std::string::npos) {
+        archetype.type = ProjectileArchetype::POISON_DART;
+        archetype.statusEffectType = 3; // Poison
+        archetype.statusDuration = 5.0f;
+    } else if (texture.find("lightning") != std::string::npos || texture.find("electric") != std::string::npos ||
+               texture.find("_arc") != std::string::npos) {
+        // "_arc" also catches tesla_tower's projectiles/electirc_arc, named after its asset file
+        archetype.type = ProjectileArchetype::LIGHTNING;
+        archetype.trailInterval = 0.01f;
+        archetype.maxPierce = 3;
+        archetype.rotationSpeed = 360.f;
+    } else if (texture.find("cannonball") != std::string::npos) {
+        archetype.type = ProjectileArchetype::CANNONBALL;
+        archetype.trailInterval = 0.05f;
+        archetype.explosionRadius = 80.f;
+    } else if (texture.find("ballista") != std::string::npos) {
+        archetype.type = ProjectileArchetype::BALLISTA_BOLT;
+        archetype.trailInterval = 0.03f;
+        archetype.maxPierce = 5;
+    } else if (texture.find("arcane") != std::string::npos) {
+        archetype.type = ProjectileArchetype::ARCANE_ORB;
+        archetype.trailInterval = 0.025f;
+        archetype.rotationSpeed = 120.f;
+    } else {
+        // Default to arrow; say so, so a misspelt texture doesn't quietly fire arrows
+        if (texture.find("arrow") == std::string::npos) {
+            std::cerr << "[ProjectileSystem] No projectile family matches texture '" << texture
+                      << "', firing arrows" << std::endl;
+        }
+        archetype.type = ProjectileArchetype::ARROW;
+        archetype.trailInterval = 0.03f;
+        archetype.rotationSpeed = 0.f; // Arrows don't spin
+    }
+    return archetype;
+}
+} // namespace
+int ProjectileSystem::internName(const std::string& name) {
+    auto it = nameHandles_.find(name);
+    if (it != nameHandles_.end()) return it->second;
+    names_.push_back(name);
+    nameHandles_.emplace(name, static_cast<int>(names_.size() - 1));
+    return static_cast<int>(names_.size() - 1);
+}
+int ProjectileSystem::registerArchetype(const std::string& source, const std::string& texture, float speed) {
+    int sourceHandle = internName(source);
+    int textureHandle = internName(texture);
+    for (size_t i = 0; i < archetypes_.size(); ++i) {
+        const ProjectileArchetype& row = archetypes_[i];
+        if (row.source == sourceHandle && row.texture == textureHandle && row.speed == speed) {
+            return static_cast<int>(i);
+        }
+    }
+    ProjectileArchetype archetype = archetypeFor(texture);
+    archetype.speed = speed;
+    archetype.texture = textureHandle;
+    archetype.source = sourceHandle;
+    archetypes_.push_back(archetype);
+    return static_cast<int>(archetypes_.size() - 1);
+}
+void ProjectileSystem::fire(int archetype, const sf::Vector2f& position, const sf::Vector2f& direction, int damage) {
     int index = projectilePool_.allocate();
     if (index == -1) return;
-    ProjectileData& data = projectilePool_.get(index);
-    data.direction = projectile.direction;
-    data.speed = projectile.speed;
-    data.damage = projectile.damage;
-    data.active = true;
-    data.atlas = projectile.atlas;
-    data.pos = position;
-    data.startPos = position;
-    data.distanceTraveled = 0.f;   
-    // PHASE 3: Determine type based on atlas with enhanced properties
-    if (projectile.atlas.find("fireball") != std::string::npos) {
-        data.type = ProjectileData::FIREBALL;
-        data.hasTrail = true;
-        data.trailInterval = 0.02f;
-        data.maxDistance = 800.f;
-        data.explodesOnImpact = true;
-        data.explosionRadius = 60.f;
-        data.rotationSpeed = 180.f; // Spinning fireball
-    } else if (projectile.atlas.find("ice") != std::string::npos) {
-        data.type = ProjectileData::ICE_SHARD;
-        data.hasTrail = true;
-        data.trailInterval = 0.04f;
-        data.appliesStatusEffect = true;
-        data.statusEffectType = 0; // Slow
-        data.statusDuration = 3.0f;
-        data.rotationSpeed = 90.f;
-    } else if (projectile.atlas.find("poison") != std::string::npos) {
-        data.type = ProjectileData::POISON_DART;
-        data.hasTrail = false;
-        data.appliesStatusEffect = true;
-        data.statusEffectType = 3; // Poison
-        data.statusDuration = 5.0f;
-    } else if (projectile.atlas.find("lightning") != std::string::npos) {
-        data.type = ProjectileData::LIGHTNING;
-        data.hasTrail = true;
-        data.trailInterval = 0.01f;
-        data.speed = 450.0f;
-        data.piercesTargets = true;
-        data.maxPierce = 3;
-        data.rotationSpeed = 360.f;
-    } else if (projectile.atlas.find("cannonball") != std::string::npos) {
-        data.type = ProjectileData::CANNONBALL;
-        data.hasTrail = true;
-        data.trailInterval = 0.05f;
-        data.speed = 200.0f;
-        data.explodesOnImpact = true;
-        data.explosionRadius = 80.f;
-    } else if (projectile.atlas.find("ballista") != std::string::npos) {
-        data.type = ProjectileData::BALLISTA_BOLT;
-        data.hasTrail = true;
-        data.trailInterval = 0.03f;
-        data.speed = 600.0f;
-        data.piercesTargets = true;
-        data.maxPierce = 5;
-    } else if (projectile.atlas.find("arcane") != std::string::npos) {
-        data.type = ProjectileData::ARCANE_ORB;
-        data.hasTrail = true;
-        data.trailInterval = 0.025f;
-        data.rotationSpeed = 120.f;
-    } else {
-        // Default to arrow
-        data.type = ProjectileData::ARROW;
-        data.hasTrail = true;
-        data.trailInterval = 0.03f;
-        data.rotationSpeed = 0.f; // Arrows don't spin
+    // The pool may have grown a page
+    if (kinematicsIndex_.size() < projectilePool_.capacity()) {
+        kinematicsIndex_.resize(projectilePool_.capacity(), 0);
     }
+    ProjectileData& data = projectilePool_.get(index);
+    static_cast<ProjectileArchetype&>(data) = archetypes_[archetype];
+    data.direction = direction;
+    data.damage = damage;
+    data.archetype = archetype;
+    data.targetsPierced = 0;
+    data.generation++;
+    kinematicsIndex_[index] = static_cast<uint32_t>(buckets_[data.type].push(
+        static_cast<uint32_t>(index), position, data.direction * data.speed, data.maxDistance,
+        data.rotationSpeed, data.trailInterval));
+}
+void ProjectileSystem::spawn(const ProjectileInfo& projectile, const sf::Vector2f& position) {
+    fire(registerArchetype(projectile.source, projectile.atlas, projectile.speed), position,
+         projectile.direction, projectile.damage);
 }
 // PHASE 3: Specific projectile spawn methods
 void ProjectileSystem::spawnArrow(const sf::Vector2f& position, const sf::Vector2f& direction, int damage) {
@@ -131,162 +176,134 @@ void ProjectileSystem::spawnCannonball(const sf::Vector2f& position, const sf::V
     spawn(info, position);
 }
 void ProjectileSystem::update(float dt) {
-    updateMovement(dt);
-    updateVisuals(dt);
-    updateRotation(dt);
-    checkCollisions();
+    forEachType([&](auto type) { updateBucket<decltype(type)::value>(dt); });
+    if (!collisionSystem_) {
+        checkCollisions();
+    }
 }
-void ProjectileSystem::updateMovement(float dt) {
-    std::vector<ProjectileData>& projectiles = projectilePool_.raw();
-    std::vector<bool>& activeFlags = projectilePool_.activeFlags();
-    for (size_t i = 0; i < projectiles.size(); ++i) {
-        if (activeFlags[i] && projectiles[i].active) {
-            ProjectileData& proj = projectiles[i];
-            // Move projectile
-            sf::Vector2f movement = proj.direction * proj.speed * dt;
-            proj.pos += movement;
-            // Update distance traveled
-            proj.distanceTraveled += std::sqrt(movement.x * movement.x + movement.y * movement.y);
-            // Deactivate if out of bounds or max distance reached
-            if (proj.pos.x < -100 || proj.pos.x > 2000 ||
-                proj.pos.y < -100 || proj.pos.y > 2000 ||
-                proj.distanceTraveled > proj.maxDistance) {
-                proj.active = false;
-                projectilePool_.free(static_cast<int>(i));
+template<ProjectileData::Type T>
+void ProjectileSystem::updateBucket(float dt) {
+    using Traits = ProjectileTraits<T>;
+    ProjectileKinematics& bucket = buckets_[T];
+    if (bucket.size() == 0) return;
+    bucket.template step<Traits::spins, Traits::trails>(dt, expired_, trailsDue_);
+    if constexpr (Traits::trails) {
+        if (particleSystem_) {
+            for (uint32_t i : trailsDue_) {
+                particleSystem_->emit(bucket.positionAt(i), Traits::trail, 1);
             }
         }
     }
+    // Highest first: each swap-remove pulls in a projectile that has already
+    // been looked at, so the positions still listed stay valid
+    for (size_t n = expired_.size(); n-- > 0;) {
+        retire(static_cast<int>(bucket.slot[expired_[n]]));
+    }
 }
-void ProjectileSystem::updateVisuals(float dt) {
-    if (!particleSystem_) return;
-    std::vector<ProjectileData>& projectiles = projectilePool_.raw();
-    std::vector<bool>& activeFlags = projectilePool_.activeFlags();
-    for (size_t i = 0; i < projectiles.size(); ++i) {
-        if (activeFlags[i] && projectiles[i].active) {
-            ProjectileData& proj = projectiles[i];
-            // Emit trail particles
-            if (proj.hasTrail) {
-                proj.trailTimer += dt;
-                if (proj.trailTimer >= proj.trailInterval) {
-                    proj.trailTimer = 0.f;                  
-                    // Emit different trail types based on projectile
-                    switch (proj.type) {
-                        case ProjectileData::FIREBALL:
-                            particleSystem_->emit(proj.pos, Particle::FIRE, 1);
-                            break;
-                        case ProjectileData::ICE_SHARD:
-                            particleSystem_->emit(proj.pos, Particle::FROST, 1);
-                            break;
-                        case ProjectileData::LIGHTNING:
-                            particleSystem_->emit(proj.pos, Particle::ELECTRIC, 1);
-                            break;
-                        case ProjectileData::CANNONBALL:
-                            particleSystem_->emit(proj.pos, Particle::SMOKE, 1);
-                            break;
-                        default:
-                            particleSystem_->emit(proj.pos, Particle::SMOKE, 1);
-                            break;
-                    }
-                }
-            }
+void ProjectileSystem::retire(int index) {
+    ProjectileKinematics& bucket = bucketOf(index);
+    uint32_t position = kinematicsIndex_[index];
+    bucket.remove(position);
+    if (position < bucket.size()) kinematicsIndex_[bucket.slot[position]] = position;
+    projectilePool_.free(index);
+}
+void ProjectileSystem::checkCollisions() {
+    if (!enemySystem_) return;
+    forEachType([&](auto type) { checkBucket<decltype(type)::value>(); });
+}
+template<ProjectileData::Type T>
+void ProjectileSystem::checkBucket() {
+    ProjectileKinematics& bucket = buckets_[T];
+    // Back to front, as applyHit may retire the projectile it is handed
+    for (size_t i = bucket.size(); i-- > 0;) {
+        const auto& hitEnemy = enemySystem_->getEnemyAtPosition(bucket.positionAt(i), 8.0f);
+        if (hitEnemy && hitEnemy->health->alive()) {
+            applyHit<T>(static_cast<int>(bucket.slot[i]), hitEnemy);
         }
     }
 }
-void ProjectileSystem::updateRotation(float dt) {
-    std::vector<ProjectileData>& projectiles = projectilePool_.raw();
-    std::vector<bool>& activeFlags = projectilePool_.activeFlags();
-    for (size_t i = 0; i < projectiles.size(); ++i) {
-        if (activeFlags[i] && projectiles[i].active) {
-            ProjectileData& proj = projectiles[i];
-            proj.rotation += proj.rotationSpeed * dt;
+void ProjectileSystem::submitColliders(CollisionSystem& collisionSystem) const {
+    for (const ProjectileKinematics& bucket : buckets_) {
+        for (size_t i = 0; i < bucket.size(); ++i) {
+            uint32_t index = bucket.slot[i];
+            EntityHandle owner{index, projectilePool_.get(static_cast<int>(index)).generation};
+            collisionSystem.submit(bucket.positionAt(i), ColliderComp(8.0f), CollisionLayer::PROJECTILE,
+                                   CollisionLayer::ENEMY, owner);
         }
     }
 }
-void ProjectileSystem::checkCollisions() {
-    if (!enemySystem_) return;
-    std::vector<ProjectileData>& projectiles = projectilePool_.raw();
-    std::vector<bool>& activeFlags = projectilePool_.activeFlags();
-    for (size_t i = 0; i < projectiles.size(); ++i) {
-        if (activeFlags[i] && projectiles[i].active) {
-            ProjectileData& proj = projectiles[i];
-            auto hitEnemy = enemySystem_->getEnemyAtPosition(proj.pos, 8.0f);
+void ProjectileSystem::resolveContacts() {
+    if (!collisionSystem_ || !enemySystem_) return;
+    collisionSystem_->forEachContact(CollisionLayer::PROJECTILE, CollisionLayer::ENEMY,
+        [&](const CollisionProxy& projectile, const CollisionProxy& enemy) {
+            int i = static_cast<int>(projectile.owner.index);
+            // An earlier contact this tick may already have used the projectile up
+            if (!projectilePool_.isActive(i) ||
+                projectilePool_.get(i).generation != projectile.owner.generation) return;
+            const auto& hitEnemy = enemySystem_->find(enemy.owner);
             if (hitEnemy && hitEnemy->health->alive()) {
-                handleProjectileImpact(i, proj.pos);
-                // Apply damage
-                hitEnemy->health->hp -= proj.damage;               
-                // Apply status effects if any
-                if (proj.appliesStatusEffect) {
-                    // This would connect to StatusEffectSystem
-                    std::cout << "Applied status effect " << proj.statusEffectType 
-                              << " for " << proj.statusDuration << " seconds\n";
-                }
-                // Check if projectile should be destroyed
-                if (!proj.piercesTargets || proj.targetsPierced >= proj.maxPierce) {
-                    proj.active = false;
-                    projectilePool_.free(static_cast<int>(i));
-                } else {
-                    proj.targetsPierced++;
-                }
+                applyHit(i, hitEnemy);
             }
-        }
-    }
+        });
+}
+void ProjectileSystem::applyHit(int index, const std::shared_ptr<Enemy>& hitEnemy) {
+    ProjectileData::Type projectileType = projectilePool_.get(index).type;
+    forEachType([&](auto type) {
+        if (type == projectileType) applyHit<decltype(type)::value>(index, hitEnemy);
+    });
 }
-void ProjectileSystem::handleProjectileImpact(size_t index, const sf::Vector2f& impactPos) {
-    ProjectileData& proj = projectilePool_.get(static_cast<int>(index));
-    // Create impact effect
-    createImpactEffect(proj.type, impactPos);
-    // Handle explosion if applicable
-    if (proj.explodesOnImpact && particleSystem_) {
-        particleSystem_->emitExplosion(impactPos, proj.explosionRadius);
-        // Damage all enemies in explosion radius
+template<ProjectileData::Type T>
+void ProjectileSystem::applyHit(int index, const std::shared_ptr<Enemy>& hitEnemy) {
+    using Traits = ProjectileTraits<T>;
+    ProjectileData& proj = projectilePool_.get(index);
+    sf::Vector2f impactPos = positionOf(index);
+    if (particleSystem_) {
+        Traits::impact(*particleSystem_, impactPos);
+    }
+    if constexpr (Traits::explodes) {
+        if (particleSystem_) {
+            particleSystem_->emitExplosion(impactPos, proj.explosionRadius);
+        }
         if (enemySystem_) {
-            auto enemiesInRange = enemySystem_->getEnemiesInRange(impactPos, proj.explosionRadius);
-            for (auto& enemy : enemiesInRange) {
-                if (enemy->health->alive()) {
+            int splashDamage = proj.damage / 2;
+            const std::string& source = names_[proj.source];
+            enemySystem_->forEachEnemyInRange(impactPos, proj.explosionRadius,
+                [splashDamage, &source](const std::shared_ptr<Enemy>& enemy) {
                     // Reduced damage for AoE
-                    enemy->health->hp -= proj.damage / 2;
-                }
-            }
+                    enemy->health->hp -= splashDamage;
+                    enemy->ai->lastHitBy = source;
+                });
         }
     }
-}
-void ProjectileSystem::createImpactEffect(ProjectileData::Type type, const sf::Vector2f& position) {
-    if (!particleSystem_) return;
-    switch (type) {
-        case ProjectileData::FIREBALL:
-            particleSystem_->emitFireEffect(position);
-            particleSystem_->emitExplosion(position, 40.0f);
-            break;
-        case ProjectileData::ICE_SHARD:
-            particleSystem_->emitFrostEffect(position);
-            break;
-        case ProjectileData::POISON_DART:
-            particleSystem_->emitPoisonCloud(position);
-            break;
-        case ProjectileData::LIGHTNING:
-            particleSystem_->emit(position, Particle::ELECTRIC, 10);
-            break;
-        case ProjectileData::CANNONBALL:
-            particleSystem_->emitExplosion(position, 60.0f);
-            break;
-        case ProjectileData::ARROW:
-            particleSystem_->emit(position, Particle::SPARKLE, 3);
-            break;
-        default:
-            particleSystem_->emit(position, Particle::SPARKLE, 2);
-            break;
+    // Apply damage
+    hitEnemy->health->hp -= proj.damage;
+    hitEnemy->ai->lastHitBy = names_[proj.source];
+    // Traits::appliesStatus types carry statusEffectType/statusDuration for
+    // StatusEffectSystem, which isn't connected yet
+    if constexpr (Traits::pierces) {
+        if (proj.targetsPierced >= proj.maxPierce) {
+            retire(index);
+        } else {
+            proj.targetsPierced++;
+        }
+    } else {
+        retire(index);
     }
 }
+ProjectileSystem::PoolStats ProjectileSystem::getPoolStats() const {
+    PoolStats stats;
+    stats.live = projectilePool_.size();
+    stats.highWater = projectilePool_.highWater();
+    stats.dropped = projectilePool_.droppedCount();
+    stats.pages = projectilePool_.pageCount();
+    stats.pageSize = projectilePool_.pageSize();
+    stats.capacity = projectilePool_.capacity();
+    stats.limit = projectilePool_.maxSize();
+    return stats;
+}
 void ProjectileSystem::clear() {
-    std::vector<ProjectileData>& projectiles = projectilePool_.raw();
-    std::vector<bool>& activeFlags = projectilePool_.activeFlags();
-    for (size_t i = 0; i < projectiles.size(); ++i) {
-        if (activeFlags[i]) {
-            projectiles[i].active = false;
-            projectilePool_.free(static_cast<int>(i));
-        }
+    projectilePool_.clear();
+    for (ProjectileKinematics& bucket : buckets_) {
+        bucket.clear();
     }
-}
-const std::vector<ProjectileData>& ProjectileSystem::getProjectiles() const {
-    return projectilePool_.raw();
 }
\ No newline at end of file
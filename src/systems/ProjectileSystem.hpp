@@ -1,55 +1,53 @@
 #pragma once
 #include <vector>
+#include <array>
 #include <functional>
 #include "../components/ProjectileInfo.hpp"
-#include "../utils/ObjectPool.hpp"
+#include "../components/ProjectileArchetype.hpp"
+#include "../utils/PagedObjectPool.hpp"
+#include "../systems/ProjectileKinematics.hpp"
 #include <string>
+#include <memory>
+#include <unordered_map>
+#include <cstdint>
 #include <SFML/System/Vector2.hpp>
 // Forward declarations
 class EnemySystem;
 class ParticleSystem;
-struct ProjectileData {
+class CollisionSystem;
+class Enemy;
+// Per-projectile data the update sweep doesn't touch; position, distance,
+// rotation and trail timer live in the type's ProjectileKinematics bucket.
+// The archetype part is copied from the firer's row at spawn.
+struct ProjectileData : ProjectileArchetype {
     sf::Vector2f direction {1,0};
-    float speed = 200.f;
     int damage = 1;
-    bool active = false;
-    std::string atlas;
-    sf::Vector2f pos;
-    // PHASE 3: Enhanced visual properties
-    sf::Vector2f startPos;
-    float distanceTraveled = 0.f;
-    float maxDistance = 1000.f;
-    bool hasTrail = false;
-    float trailTimer = 0.f;
-    float trailInterval = 0.05f;
-    float rotation = 0.f;
-    float rotationSpeed = 0.f;
-    // PHASE 3: Projectile types with special properties
-    enum Type {
-        ARROW,
-        FIREBALL,
-        ICE_SHARD,
-        POISON_DART,
-        LIGHTNING,
-        CANNONBALL,
-        BALLISTA_BOLT,
-        ARCANE_ORB
-    };
-    Type type = ARROW;  
-    // PHASE 3: Special effects
-    bool explodesOnImpact = false;
-    float explosionRadius = 0.f;
-    bool piercesTargets = false;
+    int archetype = -1;
     int targetsPierced = 0;
-    int maxPierce = 1;
-    bool appliesStatusEffect = false;
-    int statusEffectType = 0; // 0=slow, 1=burn, 2=stun, 3=poison
-    float statusDuration = 0.f;
+    uint32_t generation = 0;  // bumped on every spawn so contacts can't hit a reused slot
 };
 class ProjectileSystem {
 public:
-    ProjectileSystem(size_t poolSize = 256);
+    // The pool grows a page of pageSize projectiles at a time, never moving
+    // live ones; with maxProjectiles set, shots past it are dropped and counted
+    ProjectileSystem(size_t pageSize = 256, size_t maxProjectiles = 0);
     void initialize(EnemySystem* enemySystem, ParticleSystem* particleSystem);
+    // With a collision system attached, hits come from its contacts via
+    // resolveContacts() instead of a per-projectile enemy lookup in update()
+    void setCollisionSystem(CollisionSystem* collisionSystem);
+    void submitColliders(CollisionSystem& collisionSystem) const;
+    void resolveContacts();
+    // Row for projectiles fired by source with the given texture and speed,
+    // added on first use. Behaviour comes from the texture's family
+    // (fireball, ice, ballista...), decided here once rather than per shot.
+    int registerArchetype(const std::string& source, const std::string& texture, float speed);
+    const ProjectileArchetype& getArchetype(int archetype) const { return archetypes_[archetype]; }
+    size_t getArchetypeCount() const { return archetypes_.size(); }
+    // Texture and source names behind an archetype's handles
+    const std::string& getName(int handle) const { return names_[handle]; }
+    void fire(int archetype, const sf::Vector2f& position, const sf::Vector2f& direction, int damage);
+    // Resolves the archetype from the info's strings on every call; towers
+    // and units fire() a registered one
     void spawn(const ProjectileInfo& projectile, const sf::Vector2f& position);
     // PHASE 3: Enhanced spawn methods
     void spawnProjectile(ProjectileData::Type type, const sf::Vector2f& position, 
@@ -60,17 +58,57 @@ public:
     void spawnPoisonDart(const sf::Vector2f& position, const sf::Vector2f& direction, int damage);
     void spawnLightning(const sf::Vector2f& position, const sf::Vector2f& direction, int damage);
     void spawnCannonball(const sf::Vector2f& position, const sf::Vector2f& direction, int damage);
+    // Moves, range-culls and (where the type has them) spins and runs trail
+    // timers for every projectile: one sweep per type bucket, each with a
+    // kernel built from that type's ProjectileTraits
     void update(float dt);
     void clear();
-    const std::vector<ProjectileData>& getProjectiles() const;
+    size_t getActiveCount() const { return projectilePool_.size(); }
+    size_t getActiveCount(ProjectileData::Type type) const { return buckets_[type].size(); }
+    // How close the pool came to its limit, for sizing it per map
+    struct PoolStats {
+        size_t live = 0;
+        size_t highWater = 0;   // most projectiles in flight at once
+        uint64_t dropped = 0;   // shots lost to maxProjectiles
+        size_t pages = 0;
+        size_t pageSize = 0;
+        size_t capacity = 0;
+        size_t limit = 0;       // 0: none
+    };
+    PoolStats getPoolStats() const;
+    void setMaxProjectiles(size_t maxProjectiles) { projectilePool_.setMaxSize(maxProjectiles); }
+    void resetPoolStats() { projectilePool_.resetCounters(); }
+    // fn(data, previousPosition, position) for every live projectile
+    template<typename Fn>
+    void forEachProjectile(Fn&& fn) const {
+        for (const ProjectileKinematics& bucket : buckets_) {
+            for (size_t i = 0; i < bucket.size(); ++i) {
+                fn(projectilePool_.get(static_cast<int>(bucket.slot[i])), bucket.previousAt(i), bucket.positionAt(i));
+            }
+        }
+    }
 private:
-    void updateMovement(float dt);
-    void updateVisuals(float dt);
-    void updateRotation(float dt);
+    template<ProjectileData::Type T> void updateBucket(float dt);
+    template<ProjectileData::Type T> void checkBucket();
+    template<ProjectileData::Type T> void applyHit(int index, const std::shared_ptr<Enemy>& hitEnemy);
+    // Dispatches to applyHit<T> for the projectile's type
+    void applyHit(int index, const std::shared_ptr<Enemy>& hitEnemy);
     void checkCollisions();
-    void handleProjectileImpact(size_t index, const sf::Vector2f& impactPos);
-    void createImpactEffect(ProjectileData::Type type, const sf::Vector2f& position);
-    ObjectPool<ProjectileData> projectilePool_;
+    void retire(int index);
+    int internName(const std::string& name);
+    ProjectileKinematics& bucketOf(int index) { return buckets_[projectilePool_.get(index).type]; }
+    sf::Vector2f positionOf(int index) const {
+        return buckets_[projectilePool_.get(index).type].positionAt(kinematicsIndex_[index]);
+    }
+    PagedObjectPool<ProjectileData> projectilePool_;
+    std::vector<ProjectileArchetype> archetypes_;
+    std::vector<std::string> names_;
+    std::unordered_map<std::string, int> nameHandles_;
+    std::array<ProjectileKinematics, ProjectileData::TypeCount> buckets_;
+    std::vector<uint32_t> kinematicsIndex_;  // pool slot -> position in its type's bucket
+    std::vector<uint32_t> expired_;          // scratch for update()
+    std::vector<uint32_t> trailsDue_;
     EnemySystem* enemySystem_;
     ParticleSystem* particleSystem_; // PHASE 3: Add particle system reference
+    CollisionSystem* collisionSystem_;
 };
\ No newline at end of file
@@ -0,0 +1,91 @@
+#pragma once
+#include <SFML/System/Vector2.hpp>
+#include "../components/ProjectileArchetype.hpp"
+#include "../systems/ParticleSystem.hpp"
+// Compile-time behaviour of each projectile type. ProjectileSystem keeps a
+// bucket per type and builds that bucket's update and hit code from these,
+// so a type only runs the logic it has: arrows never test for splash or
+// pierce. A new type is a ProjectileArchetype::Type value plus a
+// specialization here that derives from ProjectileTraitsDefaults and
+// restates only what differs. explodes, pierces and appliesStatus are
+// gameplay and hold with or without a ParticleSystem; trail and impact()
+// only draw.
+struct ProjectileTraitsDefaults {
+    static constexpr bool spins = false;
+    static constexpr bool trails = true;
+    static constexpr bool explodes = false;       // half damage to all within explosionRadius
+    static constexpr bool pierces = false;        // flies on through maxPierce targets
+    static constexpr bool appliesStatus = false;  // statusEffectType for statusDuration
+    static constexpr Particle::Type trail = Particle::SMOKE;
+    static void impact(ParticleSystem& particles, const sf::Vector2f& position) {
+        particles.emit(position, Particle::SPARKLE, 2);
+    }
+};
+
+template<ProjectileArchetype::Type T>
+struct ProjectileTraits : ProjectileTraitsDefaults {};
+
+template<>
+struct ProjectileTraits<ProjectileArchetype::ARROW> : ProjectileTraitsDefaults {
+    static void impact(ParticleSystem& particles, const sf::Vector2f& position) {
+        particles.emit(position, Particle::SPARKLE, 3);
+    }
+};
+
+template<>
+struct ProjectileTraits<ProjectileArchetype::FIREBALL> : ProjectileTraitsDefaults {
+    static constexpr bool spins = true;
+    static constexpr bool explodes = true;
+    static constexpr Particle::Type trail = Particle::FIRE;
+    static void impact(ParticleSystem& particles, const sf::Vector2f& position) {
+        particles.emitFireEffect(position);
+        particles.emitExplosion(position, 40.0f);
+    }
+};
+
+template<>
+struct ProjectileTraits<ProjectileArchetype::ICE_SHARD> : ProjectileTraitsDefaults {
+    static constexpr bool spins = true;
+    static constexpr bool appliesStatus = true;
+    static constexpr Particle::Type trail = Particle::FROST;
+    static void impact(ParticleSystem& particles, const sf::Vector2f& position) {
+        particles.emitFrostEffect(position);
+    }
+};
+
+template<>
+struct ProjectileTraits<ProjectileArchetype::POISON_DART> : ProjectileTraitsDefaults {
+    static constexpr bool trails = false;
+    static constexpr bool appliesStatus = true;
+    static void impact(ParticleSystem& particles, const sf::Vector2f& position) {
+        particles.emitPoisonCloud(position);
+    }
+};
+
+template<>
+struct ProjectileTraits<ProjectileArchetype::LIGHTNING> : ProjectileTraitsDefaults {
+    static constexpr bool spins = true;
+    static constexpr bool pierces = true;
+    static constexpr Particle::Type trail = Particle::ELECTRIC;
+    static void impact(ParticleSystem& particles, const sf::Vector2f& position) {
+        particles.emit(position, Particle::ELECTRIC, 10);
+    }
+};
+
+template<>
+struct ProjectileTraits<ProjectileArchetype::CANNONBALL> : ProjectileTraitsDefaults {
+    static constexpr bool explodes = true;
+    static void impact(ParticleSystem& particles, const sf::Vector2f& position) {
+        particles.emitExplosion(position, 60.0f);
+    }
+};
+
+template<>
+struct ProjectileTraits<ProjectileArchetype::BALLISTA_BOLT> : ProjectileTraitsDefaults {
+    static constexpr bool pierces = true;
+};
+
+template<>
+struct ProjectileTraits<ProjectileArchetype::ARCANE_ORB> : ProjectileTraitsDefaults {
+    static constexpr bool spins = true;
+};
@@ -7,7 +7,6 @@
 #include "../components/TowerAI.hpp"
 #include "../components/Stats.hpp"
 #include "../components/AnimationStateComp.hpp"
-#include "../components/ProjectileInfo.hpp"
 #include "../components/Health.hpp"
 #include <algorithm>
 #include <cmath>
@@ -18,8 +17,47 @@ void TowerSystem::initialize(EnemySystem* enemySystem, ProjectileSystem* project
     enemySystem_ = enemySystem;
     projectileSystem_ = projectileSystem;
 }
+std::shared_ptr<Tower> TowerSystem::create() {
+    return std::make_shared<Tower>(store_);
+}
 void TowerSystem::add(std::shared_ptr<Tower> tower) {
-    towers_.push_back(tower);
+    tower->attachTo(store_);
+    auto policy = targetingPolicies_.find(tower->towerType);
+    if (policy != targetingPolicies_.end()) {
+        tower->ai->targeting = policy->second;
+    }
+    tower->ai->source = tower->towerType;
+    if (projectileSystem_) {
+        ProjectileSpec spec;
+        auto specIt = projectileSpecs_.find(tower->towerType);
+        if (specIt != projectileSpecs_.end()) spec = specIt->second;
+        tower->ai->projectile = projectileSystem_->registerArchetype(
+            tower->towerType, spec.texture.empty() ? "projectiles/arrow" : spec.texture,
+            spec.speed > 0.0f ? spec.speed : 400.0f);
+    }
+    store_.setActive(tower->storage, true);
+    tower->handle = towers_.insert(tower);
+}
+void TowerSystem::remove(EntityHandle handle) {
+    const std::shared_ptr<Tower>* tower = towers_.get(handle);
+    if (!tower) return;
+    store_.setActive((*tower)->storage, false);
+    towers_.erase(handle);
+}
+void TowerSystem::clear() {
+    for (auto& tower : towers_.values()) {
+        store_.setActive(tower->storage, false);
+    }
+    towers_.clear();
+}
+void TowerSystem::refreshTargets() {
+    if (!enemySystem_) return;
+    store_.view<TowerAI>().each([this](TowerAI& ai) {
+        const auto& target = enemySystem_->find(ai.currentTarget);
+        if (!target || !target->health->alive()) {
+            ai.currentTarget = EntityHandle();
+        }
+    });
 }
 void TowerSystem::update(float dt) {
     updateTargeting();
@@ -27,69 +65,78 @@ void TowerSystem::update(float dt) {
 }
 void TowerSystem::updateTargeting() {
     if (!enemySystem_) return;
-    for (auto& tower : towers_) {
-        // Check if current target is still valid
-        if (!tower->ai->currentTarget || !tower->ai->currentTarget->health->alive()) {
-            // Find new target
-            auto enemiesInRange = enemySystem_->getEnemiesInRange(
-                tower->transform->position, 
-                tower->stats->attackRange
-            );
-            if (!enemiesInRange.empty()) {
-                tower->ai->currentTarget = enemiesInRange[0];
-            } else {
-                tower->ai->currentTarget = nullptr;
-            }
-        }
+    store_.view<TowerAI, Transform, StatsComp>().each([this](TowerAI& ai, Transform& transform, StatsComp& stats) {
+        // Re-pick every tick so the target follows the policy and never stays
+        // locked on an enemy that has walked out of range
+        const auto& enemy = selectTarget(ai.targeting, transform.position, stats.attackRange);
+        ai.currentTarget = enemy ? enemy->handle : EntityHandle();
+    });
+}
+const std::shared_ptr<Enemy>& TowerSystem::selectTarget(TowerAI::Targeting targeting, const sf::Vector2f& position, float range) {
+    switch (targeting) {
+        case TowerAI::LAST:
+            return enemySystem_->findEnemyByProgress(position, range, false);
+        case TowerAI::STRONGEST:
+            return enemySystem_->findBestEnemyInRange(position, range,
+                [](const std::shared_ptr<Enemy>& enemy) { return -enemy->health->hp; });
+        case TowerAI::WEAKEST:
+            return enemySystem_->findBestEnemyInRange(position, range,
+                [](const std::shared_ptr<Enemy>& enemy) { return enemy->health->hp; });
+        case TowerAI::CLOSEST:
+            return enemySystem_->findBestEnemyInRange(position, range,
+                [&position](const std::shared_ptr<Enemy>& enemy) {
+                    sf::Vector2f diff = enemy->transform->position - position;
+                    return diff.x * diff.x + diff.y * diff.y;
+                });
+        case TowerAI::FIRST:
+        default:
+            return enemySystem_->findEnemyByProgress(position, range, true);
     }
 }
 void TowerSystem::updateCombat(float dt) {
-    if (!projectileSystem_) return;    
-    for (auto& tower : towers_) {
+    if (!projectileSystem_ || !enemySystem_) return;    
+    store_.view<TowerAI, Transform, StatsComp>().each([this, dt](TowerAI& ai, Transform& transform, StatsComp& stats) {
         // Update cooldown
-        if (tower->ai->cooldown > 0) {
-            tower->ai->cooldown -= dt;
+        if (ai.cooldown > 0) {
+            ai.cooldown -= dt;
         }
+        if (ai.cooldown > 0) return;
+        const auto& target = enemySystem_->find(ai.currentTarget);
         // Check if can attack
-        if (tower->ai->cooldown <= 0 && 
-            tower->ai->currentTarget && 
-            tower->ai->currentTarget->health->alive()) {
+        if (target && target->health->alive()) {
             // Calculate distance to target
-            float dx = tower->transform->position.x - tower->ai->currentTarget->transform->position.x;
-            float dy = tower->transform->position.y - tower->ai->currentTarget->transform->position.y;
+            float dx = transform.position.x - target->transform->position.x;
+            float dy = transform.position.y - target->transform->position.y;
             float distance = std::sqrt(dx * dx + dy * dy);
             // Check if target is in range
-            if (distance <= tower->stats->attackRange) {
-                // Create and spawn projectile
-                ProjectileInfo info;
-                info.direction = tower->ai->currentTarget->transform->position - tower->transform->position;
+            if (distance <= stats.attackRange) {
+                // Fire this tower's projectile archetype
+                sf::Vector2f direction = target->transform->position - transform.position;
                 // Normalize direction
-                float len = std::sqrt(info.direction.x * info.direction.x + info.direction.y * info.direction.y);
+                float len = std::sqrt(direction.x * direction.x + direction.y * direction.y);
                 if (len > 0.0f) {
-                    info.direction /= len;
+                    direction /= len;
+                }
+                if (ai.projectile >= 0) {
+                    projectileSystem_->fire(ai.projectile, transform.position, direction, static_cast<int>(stats.damage));
                 }
-                info.speed = 400.0f;
-                info.damage = static_cast<int>(tower->stats->damage);
-                info.active = true;
-                info.atlas = "projectiles";
-                projectileSystem_->spawn(info, tower->transform->position);
                 // Reset cooldown
-                tower->ai->cooldown = 1.0f / tower->stats->attackSpeed;
+                ai.cooldown = 1.0f / stats.attackSpeed;
             }
         }
-    }
+    });
 }
 bool TowerSystem::placeTower(std::shared_ptr<Tower> tower, const sf::Vector2f& position) {
     if (!canPlaceTower(position)) {
         return false;
     }   
     tower->transform->position = position;
-    towers_.push_back(tower);
+    add(tower);
     return true;
 }
 bool TowerSystem::canPlaceTower(const sf::Vector2f& position) const {
     // Check if position is too close to existing towers
-    for (const auto& tower : towers_) {
+    for (const auto& tower : towers_.values()) {
         sf::Vector2f diff = tower->transform->position - position;
         float distanceSq = diff.x * diff.x + diff.y * diff.y;
         float minDistance = 64.0f;
@@ -101,4 +148,10 @@ bool TowerSystem::canPlaceTower(const sf::Vector2f& position) const {
 }
 void TowerSystem::setOnTowerUpgraded(std::function<void(std::shared_ptr<Tower>)> callback) {
     onTowerUpgraded_ = callback;
+}
+void TowerSystem::setTargetingPolicies(const std::unordered_map<std::string, TowerAI::Targeting>& policies) {
+    targetingPolicies_ = policies;
+}
+void TowerSystem::setProjectileSpecs(const std::unordered_map<std::string, ProjectileSpec>& specs) {
+    projectileSpecs_ = specs;
 }
\ No newline at end of file
@@ -2,29 +2,58 @@
 #include <vector>
 #include <memory>
 #include <functional>
+#include <string>
+#include <unordered_map>
 #include <SFML/System/Vector2.hpp>
+#include "../core/Archetypes.hpp"
+#include "../core/EntityHandle.hpp"
+#include "../utils/SlotMap.hpp"
+#include "../components/TowerAI.hpp"
+#include "../components/ProjectileArchetype.hpp"
 // Forward declarations ONLY
 class Tower;
+class Enemy;
 class EnemySystem;
 class ProjectileSystem;
 class TowerSystem {
 public:
     TowerSystem();
     void initialize(EnemySystem* enemySystem, ProjectileSystem* projectileSystem);
+    std::shared_ptr<Tower> create();
     void add(std::shared_ptr<Tower> tower);
+    void remove(EntityHandle handle);
+    void clear();
+    // Drops targets whose enemy has been removed or died since the last tick.
+    // Runs before the tower entities update so none of them fires at a stale handle.
+    void refreshTargets();
     void update(float dt);
     bool placeTower(std::shared_ptr<Tower> tower, const sf::Vector2f& position);
     bool canPlaceTower(const sf::Vector2f& position) const;
     void setOnTowerUpgraded(std::function<void(std::shared_ptr<Tower>)> callback);
+    // Targeting policy by tower type, applied as towers are added
+    void setTargetingPolicies(const std::unordered_map<std::string, TowerAI::Targeting>& policies);
+    // Projectile by tower type, resolved to an archetype as towers are added;
+    // types without one fire arrows
+    void setProjectileSpecs(const std::unordered_map<std::string, ProjectileSpec>& specs);
     // FIXED: Return const reference for reading
-    const std::vector<std::shared_ptr<Tower>>& getTowers() const { return towers_; }
-    // ADDED: Return non-const reference for modifying (use carefully)
-    std::vector<std::shared_ptr<Tower>>& getTowersModifiable() { return towers_; }
+    // Use add/remove/clear to change membership so the store stays in sync
+    const std::vector<std::shared_ptr<Tower>>& getTowers() const { return towers_.values(); }
+    // Empty pointer if the handle is null or the tower has been removed
+    const std::shared_ptr<Tower>& find(EntityHandle handle) const {
+        const std::shared_ptr<Tower>* tower = towers_.get(handle);
+        return tower ? *tower : noTower_;
+    }
+    TowerStore& getStore() { return store_; }
 private:
     void updateTargeting();
+    const std::shared_ptr<Enemy>& selectTarget(TowerAI::Targeting targeting, const sf::Vector2f& position, float range);
     void updateCombat(float dt);
-    std::vector<std::shared_ptr<Tower>> towers_;
+    SlotMap<std::shared_ptr<Tower>> towers_;
+    std::shared_ptr<Tower> noTower_;
+    TowerStore store_;
     EnemySystem* enemySystem_;
     ProjectileSystem* projectileSystem_;
     std::function<void(std::shared_ptr<Tower>)> onTowerUpgraded_;
+    std::unordered_map<std::string, TowerAI::Targeting> targetingPolicies_;
+    std::unordered_map<std::string, ProjectileSpec> projectileSpecs_;
 };
\ No newline at end of file
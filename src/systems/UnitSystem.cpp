@@ -10,12 +10,11 @@
 #include "../components/ColliderComp.hpp"
 #include "../components/SelectableComp.hpp"
 #include "../components/AnimationStateComp.hpp"
-#include "../components/ProjectileInfo.hpp"
 #include <algorithm>
 #include <cmath>
 
 UnitSystem::UnitSystem()
-    : enemySystem_(nullptr), projectileSystem_(nullptr), selectedUnit_(nullptr) {
+    : enemySystem_(nullptr), projectileSystem_(nullptr) {
 }
 
 void UnitSystem::initialize(EnemySystem* enemySystem, ProjectileSystem* projectileSystem) {
@@ -23,8 +22,49 @@ void UnitSystem::initialize(EnemySystem* enemySystem, ProjectileSystem* projecti
     projectileSystem_ = projectileSystem;
 }
 
+std::shared_ptr<Unit> UnitSystem::create() {
+    return std::make_shared<Unit>(store_);
+}
+
 void UnitSystem::add(std::shared_ptr<Unit> unit) {
-    units_.push_back(unit);
+    unit->attachTo(store_);
+    store_.setActive(unit->storage, true);
+    unit->transform->previousPosition = unit->transform->position;
+    unit->ai->source = unit->unitType;
+    if (projectileSystem_) {
+        ProjectileSpec spec;
+        auto specIt = projectileSpecs_.find(unit->unitType);
+        if (specIt != projectileSpecs_.end()) spec = specIt->second;
+        unit->ai->projectile = projectileSystem_->registerArchetype(
+            unit->unitType, spec.texture.empty() ? "projectiles/arrow" : spec.texture,
+            spec.speed > 0.0f ? spec.speed : 300.0f);
+    }
+    unit->handle = units_.insert(unit);
+}
+
+void UnitSystem::setProjectileSpecs(const std::unordered_map<std::string, ProjectileSpec>& specs) {
+    projectileSpecs_ = specs;
+}
+
+void UnitSystem::clear() {
+    clearSelection();
+    for (auto& unit : units_.values()) {
+        store_.setActive(unit->storage, false);
+    }
+    units_.clear();
+}
+
+void UnitSystem::refreshTargets() {
+    if (!enemySystem_) return;
+    
+    store_.view<UnitAI>().each([this](UnitAI& ai) {
+        const auto& target = enemySystem_->find(ai.currentTarget);
+        if (target && target->health->alive()) {
+            ai.targetPosition = target->transform->position;
+        } else {
+            ai.currentTarget = EntityHandle();
+        }
+    });
 }
 
 void UnitSystem::update(float dt) {
@@ -36,107 +76,107 @@ void UnitSystem::update(float dt) {
 void UnitSystem::updateTargeting() {
     if (!enemySystem_) return;
     
-    for (auto& unit : units_) {
-        if (!unit->health->alive()) continue;
+    store_.view<UnitAI, Transform, HealthComp, StatsComp>().each(
+        [this](UnitAI& ai, Transform& transform, HealthComp& health, StatsComp& stats) {
+        if (!health.alive()) return;
         
-        // Check if current target is still valid
-        if (!unit->ai->currentTarget || !unit->ai->currentTarget->health->alive()) {
+        // Check if current target is still valid; a removed enemy's handle no longer resolves
+        const auto& target = enemySystem_->find(ai.currentTarget);
+        if (!target || !target->health->alive()) {
             // Find new target in range
-            auto enemiesInRange = enemySystem_->getEnemiesInRange(
-                unit->transform->position, 
-                unit->stats->attackRange
+            const auto& enemy = enemySystem_->findFirstEnemyInRange(
+                transform.position, 
+                stats.attackRange
             );
-            
-            if (!enemiesInRange.empty()) {
-                unit->ai->currentTarget = enemiesInRange[0];
-            } else {
-                unit->ai->currentTarget = nullptr;
-            }
+            ai.currentTarget = enemy ? enemy->handle : EntityHandle();
+            if (enemy) ai.targetPosition = enemy->transform->position;
         }
-    }
+    });
 }
 
 void UnitSystem::updateCombat(float dt) {
-    for (auto& unit : units_) {
-        if (!unit->health->alive()) continue;
+    if (!enemySystem_) return;
+    
+    store_.view<UnitAI, Transform, HealthComp, StatsComp>().each(
+        [this, dt](UnitAI& ai, Transform& transform, HealthComp& health, StatsComp& stats) {
+        if (!health.alive()) return;
         
         // Update cooldown
-        if (unit->ai->cooldown > 0) {
-            unit->ai->cooldown -= dt;
+        if (ai.cooldown > 0) {
+            ai.cooldown -= dt;
         }
+        if (ai.cooldown > 0) return;
         
+        const auto& target = enemySystem_->find(ai.currentTarget);
         // Check if can attack
-        if (unit->ai->cooldown <= 0 && 
-            unit->ai->currentTarget && 
-            unit->ai->currentTarget->health->alive()) {
+        if (target && target->health->alive()) {
             // Calculate distance to target
-            float dx = unit->transform->position.x - unit->ai->currentTarget->transform->position.x;
-            float dy = unit->transform->position.y - unit->ai->currentTarget->transform->position.y;
+            float dx = transform.position.x - target->transform->position.x;
+            float dy = transform.position.y - target->transform->position.y;
             float distance = std::sqrt(dx * dx + dy * dy);
             
             // Check if target is in range
-            if (distance <= unit->stats->attackRange) {
-                if (!unit->ai->melee && projectileSystem_) {
-                    // Ranged attack - spawn projectile
-                    ProjectileInfo info;
-                    info.direction = unit->ai->currentTarget->transform->position - unit->transform->position;
+            if (distance <= stats.attackRange) {
+                if (!ai.melee && projectileSystem_) {
+                    // Ranged attack - fire this unit's projectile archetype
+                    sf::Vector2f direction = target->transform->position - transform.position;
                     
                     // Normalize direction
-                    float len = std::sqrt(info.direction.x * info.direction.x + info.direction.y * info.direction.y);
+                    float len = std::sqrt(direction.x * direction.x + direction.y * direction.y);
                     if (len > 0.0f) {
-                        info.direction /= len;
+                        direction /= len;
                     }
                     
-                    info.speed = 300.0f;
-                    info.damage = static_cast<int>(unit->stats->damage);
-                    info.active = true;
-                    info.atlas = "projectiles";
-                    
-                    projectileSystem_->spawn(info, unit->transform->position);
+                    if (ai.projectile >= 0) {
+                        projectileSystem_->fire(ai.projectile, transform.position, direction, static_cast<int>(stats.damage));
+                    }
                     
-                } else if (unit->ai->melee) {
+                } else if (ai.melee) {
                     // Melee attack - direct damage
-                    unit->ai->currentTarget->health->hp -= static_cast<int>(unit->stats->damage);
+                    target->health->hp -= static_cast<int>(stats.damage);
+                    target->ai->lastHitBy = ai.source;
                 }
                 
                 // Reset cooldown
-                unit->ai->cooldown = 1.0f / unit->stats->attackSpeed;
+                ai.cooldown = 1.0f / stats.attackSpeed;
             }
         }
-    }
+    });
 }
 
 void UnitSystem::removeDead() {
-    units_.erase(std::remove_if(units_.begin(), units_.end(),
-        [this](const std::shared_ptr<Unit>& unit) {
-            if (!unit->health->alive()) {
-                if (onUnitDied_) onUnitDied_(unit);
-                if (selectedUnit_ == unit) selectedUnit_ = nullptr;
-                return true;
-            }
-            return false;
-        }), units_.end());
+    auto& units = units_.values();
+    for (size_t i = 0; i < units.size();) {
+        std::shared_ptr<Unit> unit = units[i];
+        if (unit->health->alive()) {
+            ++i;
+            continue;
+        }
+        store_.setActive(unit->storage, false);
+        if (onUnitDied_) onUnitDied_(unit);
+        if (selectedUnit_ == unit->handle) selectedUnit_ = EntityHandle();
+        // Swap-removes; the last unit moves into slot i
+        units_.erase(unit->handle);
+    }
 }
 
 void UnitSystem::setSelectedUnit(std::shared_ptr<Unit> unit) {
-    if (selectedUnit_) {
-        selectedUnit_->selectable->selected = false;
-    }
-    selectedUnit_ = unit;
-    if (selectedUnit_) {
-        selectedUnit_->selectable->selected = true;
+    clearSelection();
+    if (unit) {
+        unit->selectable->selected = true;
+        selectedUnit_ = unit->handle;
     }
 }
 
 void UnitSystem::clearSelection() {
-    if (selectedUnit_) {
-        selectedUnit_->selectable->selected = false;
-        selectedUnit_ = nullptr;
+    if (const auto& unit = find(selectedUnit_)) {
+        unit->selectable->selected = false;
     }
+    selectedUnit_ = EntityHandle();
 }
 
 std::shared_ptr<Unit> UnitSystem::getUnitAtPosition(const sf::Vector2f& position) {
-    for (auto& unit : units_) {
+    for (auto& unit : units_.values()) {
         if (!unit->health->alive()) continue;
         
         sf::Vector2f diff = unit->transform->position - position;
@@ -154,7 +194,7 @@ std::vector<std::shared_ptr<Unit>> UnitSystem::getUnitsInRange(const sf::Vector2
     std::vector<std::shared_ptr<Unit>> result;
     float rangeSq = range * range;
     
-    for (auto& unit : units_) {
+    for (auto& unit : units_.values()) {
         if (!unit->health->alive()) continue;
 
         sf::Vector2f diff = unit->transform->position - position;
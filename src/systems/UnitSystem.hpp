@@ -11,19 +11,35 @@ class Enemy;
 
 // INCLUDE THE ACTUAL UNIT CLASS DEFINITION
 #include "../entities/Unit.hpp"  // ADD THIS LINE
+#include "../utils/SlotMap.hpp"
+#include "../components/ProjectileArchetype.hpp"
+#include <string>
+#include <unordered_map>
 
 class UnitSystem {
 private:
-    std::vector<std::shared_ptr<Unit>> units_;
+    SlotMap<std::shared_ptr<Unit>> units_;
+    UnitStore store_;
     EnemySystem* enemySystem_;
     ProjectileSystem* projectileSystem_;
-    std::shared_ptr<Unit> selectedUnit_;
+    EntityHandle selectedUnit_;
+    std::shared_ptr<Unit> noUnit_;
     std::function<void(std::shared_ptr<Unit>)> onUnitDied_;
+    std::unordered_map<std::string, ProjectileSpec> projectileSpecs_;
 
 public:
     UnitSystem();
     void initialize(EnemySystem* enemySystem, ProjectileSystem* projectileSystem);
+    std::shared_ptr<Unit> create();
     void add(std::shared_ptr<Unit> unit);
+    // Projectile by unit type, resolved to an archetype as units are added;
+    // types without one fire arrows
+    void setProjectileSpecs(const std::unordered_map<std::string, ProjectileSpec>& specs);
+    void clear();
+    // Drops targets whose enemy has been removed or died and caches the
+    // position of the rest. Runs before the unit entities update, which
+    // steer toward ai->targetPosition.
+    void refreshTargets();
     void update(float dt);
     void removeDead();
     
@@ -34,11 +50,16 @@ public:
     std::vector<std::shared_ptr<Unit>> getUnitsInRange(const sf::Vector2f& position, float range);
     
     // Getters
-    std::vector<std::shared_ptr<Unit>>& getUnits() { return units_; }
-    std::vector<std::shared_ptr<Unit>>& getUnitsModifiable() { return units_; }
+    const std::vector<std::shared_ptr<Unit>>& getUnits() const { return units_.values(); }
+    // Empty pointer if the handle is null or the unit has been removed
+    const std::shared_ptr<Unit>& find(EntityHandle handle) const {
+        const std::shared_ptr<Unit>* unit = units_.get(handle);
+        return unit ? *unit : noUnit_;
+    }
+    UnitStore& getStore() { return store_; }
     int getAliveCount() const {
         int count = 0;
-        for (const auto& unit : units_) {
+        for (const auto& unit : units_.values()) {
             if (unit->health->alive()) count++;
         }
         return count;
@@ -66,13 +66,14 @@ void WaveSystem::update(float dt) {
             // Delay is over, ready to spawn
             waitingForDelay_ = false;
             spawnTimer_ = 0.0f;
+            nextInterval_ = jitter(currentGroup.interval);
             std::cout << "[WaveSystem] Delay over for group " << currentGroupIndex_ << " - starting spawns" << std::endl;
         }
         return;
     }
     
     // Check if it's time to spawn
-    if (spawnTimer_ >= currentGroup.interval) {
+    if (spawnTimer_ >= nextInterval_) {
         if (currentGroupCount_ < currentGroup.count) {
             if (spawnCallback_) {
                 std::cout << "[WaveSystem] Spawning " << currentGroup.id << " (" 
@@ -81,6 +82,7 @@ void WaveSystem::update(float dt) {
                 currentGroupCount_++;
             }
             spawnTimer_ = 0.0f;
+            nextInterval_ = jitter(currentGroup.interval);
         }
         
         // If we've spawned all in this group, move to next
@@ -115,6 +117,16 @@ void WaveSystem::setSpawnCallback(SpawnCallback callback) {
     spawnCallback_ = callback;
 }
 
+void WaveSystem::setSpawnJitter(float fraction, uint32_t seed) {
+    spawnJitter_ = fraction;
+    random_.seed(seed);
+}
+
+float WaveSystem::jitter(float interval) {
+    if (spawnJitter_ <= 0.0f) return interval;
+    return interval * (1.0f + random_.range(-spawnJitter_, spawnJitter_));
+}
+
 int WaveSystem::getCurrentWave() const {
     return currentWaveIndex_;
 }
@@ -3,6 +3,7 @@
 #include <functional>
 #include <string>
 #include "../json/types.hpp"
+#include "../utils/Random.hpp"
 
 class WaveSystem {
 public:
@@ -18,6 +19,8 @@ public:
     bool isFinished() const;
     
     void setSpawnCallback(SpawnCallback callback);
+    // Spreads each spawn interval by up to +/- fraction (0 = as authored), seeded for repeatable runs
+    void setSpawnJitter(float fraction, uint32_t seed);
     
     int getCurrentWave() const;
     int getTotalWaves() const;
@@ -32,4 +35,8 @@ private:
     float spawnTimer_;
     bool waitingForDelay_;  // Added this member variable
     SpawnCallback spawnCallback_;
+    float spawnJitter_ = 0.0f;
+    float nextInterval_ = 0.0f;
+    Random random_;
+    float jitter(float interval);
 };
\ No newline at end of file
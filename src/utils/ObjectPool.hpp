@@ -1,48 +1,107 @@
 #pragma once
 #include <vector>
-#include <functional>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include "../utils/SlotAllocator.hpp"
+// Fixed-capacity pool of T addressed by slot index. SlotAllocator does the
+// bookkeeping: O(1) allocate() and free(), iteration over live slots only,
+// double frees caught. Slots keep their value when freed and are handed out
+// again as they are; reset what you use.
 template<typename T>
 class ObjectPool {
 public:
     ObjectPool(size_t size = 128) {
         items_.resize(size);
-        active_.resize(size, false);
+        // A fresh pool hands out 0, 1, 2...
+        slots_.grow(size);
     }
+    // A free slot, or -1 when the pool is full
     int allocate() {
-        for (size_t i = 0; i < items_.size(); i++) {
-            if (!active_[i]) {
-                active_[i] = true;
-                return static_cast<int>(i);
-            }
-        }
-        return -1;
+        return slots_.allocate();
     }
+    // Frees a live slot. Freeing one that isn't live is a no-op, and an
+    // assertion in debug builds.
     void free(int index) {
-        if (index >= 0 && index < static_cast<int>(active_.size())) {
-            active_[index] = false;
-        }
+        slots_.free(index);
+    }
+    bool isActive(int index) const {
+        return slots_.isActive(index);
+    }
+    void clear() {
+        slots_.clear();
     }
+    size_t size() const { return slots_.size(); }  // live objects
+    size_t capacity() const { return items_.size(); }
+    bool empty() const { return slots_.empty(); }
+    bool full() const { return slots_.full(); }
     // Return non-const references
-    T& get(int index) { 
-        return items_[index]; 
+    T& get(int index) {
+        return items_[index];
     }
-    const T& get(int index) const { 
-        return items_[index]; 
+    const T& get(int index) const {
+        return items_[index];
     }
-    // Return non-const references to the underlying vectors
-    std::vector<T>& raw() { 
-        return items_; 
+    // Every slot, live or not, by index
+    std::vector<T>& raw() {
+        return items_;
     }
-    const std::vector<T>& raw() const { 
-        return items_; 
+    const std::vector<T>& raw() const {
+        return items_;
     }
-    std::vector<bool>& activeFlags() { 
-        return active_; 
+    // Indices of the live slots, in no particular order
+    const std::vector<uint32_t>& activeIndices() const {
+        return slots_.dense();
     }
-    const std::vector<bool>& activeFlags() const { 
-        return active_; 
+    // Calls fn(index, object) for every live slot. fn may free the slot it
+    // was handed (the walk runs back to front, so the slot swapped in has
+    // been visited already) but no other.
+    template<typename Fn>
+    void forEachActive(Fn&& fn) {
+        const std::vector<uint32_t>& dense = slots_.dense();
+        for (size_t i = dense.size(); i-- > 0;) {
+            int index = static_cast<int>(dense[i]);
+            fn(index, items_[index]);
+        }
+    }
+    template<typename Fn>
+    void forEachActive(Fn&& fn) const {
+        const std::vector<uint32_t>& dense = slots_.dense();
+        for (size_t i = dense.size(); i-- > 0;) {
+            int index = static_cast<int>(dense[i]);
+            fn(index, items_[index]);
+        }
     }
+
+    // Iterates live objects; index() gives the slot. Don't free while
+    // iterating with these, use forEachActive for that.
+    template<typename Pool, typename Value>
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Value*;
+        using reference = Value&;
+        Iterator(Pool* pool, size_t position) : pool_(pool), position_(position) {}
+        reference operator*() const { return pool_->items_[index()]; }
+        pointer operator->() const { return &pool_->items_[index()]; }
+        int index() const { return static_cast<int>(pool_->slots_.dense()[position_]); }
+        Iterator& operator++() { ++position_; return *this; }
+        Iterator operator++(int) { Iterator previous = *this; ++position_; return previous; }
+        bool operator==(const Iterator& other) const { return position_ == other.position_; }
+        bool operator!=(const Iterator& other) const { return position_ != other.position_; }
+    private:
+        Pool* pool_;
+        size_t position_;
+    };
+    using iterator = Iterator<ObjectPool, T>;
+    using const_iterator = Iterator<const ObjectPool, const T>;
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, slots_.size()); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, slots_.size()); }
 private:
     std::vector<T> items_;
-    std::vector<bool> active_;
+    SlotAllocator slots_;
 };
\ No newline at end of file
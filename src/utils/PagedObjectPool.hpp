@@ -0,0 +1,89 @@
+#pragma once
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include "../utils/SlotAllocator.hpp"
+// ObjectPool that grows instead of refusing: when the free list runs dry a
+// new page of pageSize objects is added. Pages are never moved or released,
+// so references to live objects stay valid across growth. With a size limit
+// set, allocate() fails once that many objects are live, and each failure is
+// counted. Slot bookkeeping is SlotAllocator's, as in ObjectPool;
+// pageSize is rounded up to a power of two so get() is a shift and a mask.
+template<typename T>
+class PagedObjectPool {
+public:
+    // maxSize 0 means no limit
+    explicit PagedObjectPool(size_t pageSize = 256, size_t maxSize = 0) : maxSize_(maxSize) {
+        while ((size_t(1) << pageShift_) < pageSize) pageShift_++;
+        addPage();
+    }
+    // A free slot, or -1 at the size limit
+    int allocate() {
+        if (maxSize_ > 0 && slots_.size() >= maxSize_) {
+            dropped_++;
+            return -1;
+        }
+        if (slots_.full()) addPage();
+        int index = slots_.allocate();
+        if (slots_.size() > highWater_) highWater_ = slots_.size();
+        return index;
+    }
+    // Frees a live slot. Freeing one that isn't live is a no-op, and an
+    // assertion in debug builds.
+    void free(int index) {
+        slots_.free(index);
+    }
+    bool isActive(int index) const {
+        return slots_.isActive(index);
+    }
+    // Frees every slot; pages and counters stay
+    void clear() {
+        slots_.clear();
+    }
+    T& get(int index) {
+        return pages_[index >> pageShift_][index & pageMask()];
+    }
+    const T& get(int index) const {
+        return pages_[index >> pageShift_][index & pageMask()];
+    }
+    size_t size() const { return slots_.size(); }  // live objects
+    size_t capacity() const { return slots_.capacity(); }
+    bool empty() const { return slots_.empty(); }
+    const std::vector<uint32_t>& activeIndices() const { return slots_.dense(); }
+    // Calls fn(index, object) for every live slot; fn may free the slot it
+    // was handed but no other (see ObjectPool::forEachActive)
+    template<typename Fn>
+    void forEachActive(Fn&& fn) {
+        const std::vector<uint32_t>& dense = slots_.dense();
+        for (size_t i = dense.size(); i-- > 0;) {
+            int index = static_cast<int>(dense[i]);
+            fn(index, get(index));
+        }
+    }
+
+    // Saturation figures, for sizing pools per map
+    size_t pageSize() const { return size_t(1) << pageShift_; }
+    size_t pageCount() const { return pages_.size(); }
+    size_t maxSize() const { return maxSize_; }
+    // Takes effect for later allocations; live objects over a lowered limit stay
+    void setMaxSize(size_t maxSize) { maxSize_ = maxSize; }
+    size_t highWater() const { return highWater_; }     // most objects live at once
+    uint64_t droppedCount() const { return dropped_; }  // allocations refused at the limit
+    void resetCounters() {
+        highWater_ = slots_.size();
+        dropped_ = 0;
+    }
+private:
+    size_t pageMask() const { return (size_t(1) << pageShift_) - 1; }
+    void addPage() {
+        pages_.emplace_back(new T[pageSize()]());
+        slots_.grow(pageSize());
+    }
+    std::vector<std::unique_ptr<T[]>> pages_;
+    SlotAllocator slots_;
+    size_t pageShift_ = 0;
+    size_t maxSize_ = 0;
+    size_t highWater_ = 0;
+    uint64_t dropped_ = 0;
+};
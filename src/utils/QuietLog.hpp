@@ -0,0 +1,29 @@
+#pragma once
+#include <iostream>
+#include <streambuf>
+// Silences std::cout while alive. The game systems log straight to std::cout;
+// the window-free drivers use this to keep that out of their output and
+// timing. The stand-in buffer keeps nothing, so threads logging at once
+// share no state through it.
+class QuietLog {
+public:
+    explicit QuietLog(bool enabled = true)
+        : previous_(enabled ? std::cout.rdbuf(&discard_) : nullptr) {}
+    ~QuietLog() { restore(); }
+    QuietLog(const QuietLog&) = delete;
+    QuietLog& operator=(const QuietLog&) = delete;
+    // Brings output back early, e.g. to report an error
+    void restore() {
+        if (previous_) {
+            std::cout.rdbuf(previous_);
+            previous_ = nullptr;
+        }
+    }
+private:
+    struct Discard : std::streambuf {
+        int overflow(int ch) override { return traits_type::not_eof(ch); }
+        std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+    };
+    Discard discard_;
+    std::streambuf* previous_;
+};
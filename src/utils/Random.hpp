@@ -1,9 +1,15 @@
 #pragma once
+#include <cstdint>
 #include <random>
+// One generator per owner (particle system, wave jitter, ...) so parallel
+// simulations never share state. Seed it for reproducible runs.
 class Random {
 public:
-    static float range(float a, float b);
-    static int rangeInt(int a, int b);
+    Random() : gen_(std::random_device{}()) {}
+    explicit Random(uint32_t seed) : gen_(seed) {}
+    void seed(uint32_t seed) { gen_.seed(seed); }
+    float range(float a, float b);
+    int rangeInt(int a, int b);
 private:
-    static std::mt19937& generator();
+    std::mt19937 gen_;
 };
\ No newline at end of file
@@ -0,0 +1,68 @@
+#pragma once
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+// Slot bookkeeping shared by ObjectPool and PagedObjectPool; the pools own
+// the objects, this hands out their indices. Free slots form a linked list
+// threaded through links_, so allocate() and free() are O(1). Live slots
+// are also kept in a dense array, so iteration touches only live slots.
+// A slot is live when its dense position points back at it (the sparse-set
+// test), which is also how free() catches a double free.
+class SlotAllocator {
+public:
+    // Adds count slots, handed out in index order before any already free
+    void grow(size_t count) {
+        const size_t first = links_.size();
+        links_.resize(first + count);
+        dense_.reserve(first + count);
+        for (size_t i = 0; i < count; i++) {
+            links_[first + i] = i + 1 < count ? static_cast<int32_t>(first + i + 1) : freeHead_;
+        }
+        if (count > 0) freeHead_ = static_cast<int32_t>(first);
+    }
+    // A free slot, or -1 when there is none
+    int allocate() {
+        if (freeHead_ < 0) return -1;
+        int index = freeHead_;
+        freeHead_ = links_[index];
+        links_[index] = static_cast<int32_t>(dense_.size());
+        dense_.push_back(static_cast<uint32_t>(index));
+        return index;
+    }
+    // Frees a live slot. Freeing one that isn't live is a no-op, and an
+    // assertion in debug builds.
+    void free(int index) {
+        if (!isActive(index)) {
+            assert(!"free: slot is not allocated (double free?)");
+            return;
+        }
+        // Swap-remove from the dense array
+        uint32_t position = static_cast<uint32_t>(links_[index]);
+        uint32_t last = dense_.back();
+        dense_[position] = last;
+        links_[last] = static_cast<int32_t>(position);
+        dense_.pop_back();
+        links_[index] = freeHead_;
+        freeHead_ = index;
+    }
+    bool isActive(int index) const {
+        if (index < 0 || index >= static_cast<int>(links_.size())) return false;
+        int32_t position = links_[index];
+        return position >= 0 && static_cast<size_t>(position) < dense_.size() &&
+               dense_[position] == static_cast<uint32_t>(index);
+    }
+    void clear() {
+        while (!dense_.empty()) free(static_cast<int>(dense_.back()));
+    }
+    size_t size() const { return dense_.size(); }  // live slots
+    size_t capacity() const { return links_.size(); }
+    bool empty() const { return dense_.empty(); }
+    bool full() const { return freeHead_ < 0; }
+    // Indices of the live slots, in no particular order
+    const std::vector<uint32_t>& dense() const { return dense_; }
+private:
+    std::vector<int32_t> links_;   // live: position in dense_; free: next free slot or -1
+    std::vector<uint32_t> dense_;  // live slot indices
+    int32_t freeHead_ = -1;
+};
@@ -0,0 +1,78 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include "../core/EntityHandle.hpp"
+// Dense array of values addressed through generational handles.
+// insert/erase/get are O(1); erase swap-removes, so values() stays packed
+// but its order is not stable.
+template<typename T>
+class SlotMap {
+public:
+    EntityHandle insert(T value) {
+        uint32_t slot;
+        if (!freeSlots_.empty()) {
+            slot = freeSlots_.back();
+            freeSlots_.pop_back();
+        } else {
+            slot = static_cast<uint32_t>(slots_.size());
+            slots_.push_back(Slot());
+        }
+        slots_[slot].dense = static_cast<uint32_t>(values_.size());
+        values_.push_back(std::move(value));
+        denseToSlot_.push_back(slot);
+        return EntityHandle{slot, slots_[slot].generation};
+    }
+    bool erase(EntityHandle handle) {
+        if (!contains(handle)) return false;
+        uint32_t dense = slots_[handle.index].dense;
+        uint32_t last = static_cast<uint32_t>(values_.size() - 1);
+        if (dense != last) {
+            values_[dense] = std::move(values_[last]);
+            denseToSlot_[dense] = denseToSlot_[last];
+            slots_[denseToSlot_[dense]].dense = dense;
+        }
+        values_.pop_back();
+        denseToSlot_.pop_back();
+        retire(handle.index);
+        return true;
+    }
+    void clear() {
+        for (uint32_t slot : denseToSlot_) retire(slot);
+        values_.clear();
+        denseToSlot_.clear();
+    }
+    bool contains(EntityHandle handle) const {
+        return handle.index < slots_.size() && handle.generation != 0 &&
+               slots_[handle.index].generation == handle.generation;
+    }
+    T* get(EntityHandle handle) {
+        return contains(handle) ? &values_[slots_[handle.index].dense] : nullptr;
+    }
+    const T* get(EntityHandle handle) const {
+        return contains(handle) ? &values_[slots_[handle.index].dense] : nullptr;
+    }
+    EntityHandle handleAt(size_t denseIndex) const {
+        uint32_t slot = denseToSlot_[denseIndex];
+        return EntityHandle{slot, slots_[slot].generation};
+    }
+    size_t size() const { return values_.size(); }
+    bool empty() const { return values_.empty(); }
+    std::vector<T>& values() { return values_; }
+    const std::vector<T>& values() const { return values_; }
+private:
+    struct Slot {
+        uint32_t generation = 1;
+        uint32_t dense = 0;
+    };
+    void retire(uint32_t slot) {
+        // Skip 0 on wrap-around so no live handle ever looks null
+        if (++slots_[slot].generation == 0) slots_[slot].generation = 1;
+        freeSlots_.push_back(slot);
+    }
+    std::vector<Slot> slots_;
+    std::vector<T> values_;
+    std::vector<uint32_t> denseToSlot_;
+    std::vector<uint32_t> freeSlots_;
+};
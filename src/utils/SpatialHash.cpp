@@ -0,0 +1,71 @@
+#include "../utils/SpatialHash.hpp"
+#include <algorithm>
+#include <cmath>
+SpatialHash::SpatialHash(float cellSize, int maxCellsPerAxis)
+    : cellSize_(cellSize), invCellSize_(1.0f / cellSize),
+      maxCellsPerAxis_(std::max(1, maxCellsPerAxis)) {
+}
+void SpatialHash::clear() {
+    entries_.clear();
+    indexed_ = 0;
+    cols_ = rows_ = 0;
+}
+void SpatialHash::insert(int id, const sf::Vector2f& position, float key) {
+    entries_.push_back({id, position, key});
+}
+void SpatialHash::rebuild() {
+    indexed_ = entries_.size();
+    if (indexed_ == 0) {
+        cols_ = rows_ = 0;
+        return;
+    }
+    sf::Vector2f minPos = entries_[0].position;
+    sf::Vector2f maxPos = minPos;
+    for (const auto& entry : entries_) {
+        minPos.x = std::min(minPos.x, entry.position.x);
+        minPos.y = std::min(minPos.y, entry.position.y);
+        maxPos.x = std::max(maxPos.x, entry.position.x);
+        maxPos.y = std::max(maxPos.y, entry.position.y);
+    }
+    // Stretch cells if the points are spread wider than maxCellsPerAxis_ allows
+    float extent = std::max(maxPos.x - minPos.x, maxPos.y - minPos.y);
+    float size = std::max(cellSize_, extent / maxCellsPerAxis_);
+    invCellSize_ = 1.0f / size;
+    origin_ = minPos;
+    cols_ = std::min(maxCellsPerAxis_, static_cast<int>((maxPos.x - minPos.x) * invCellSize_) + 1);
+    rows_ = std::min(maxCellsPerAxis_, static_cast<int>((maxPos.y - minPos.y) * invCellSize_) + 1);
+    // Counting sort: histogram, prefix sum, scatter
+    cellStart_.assign(static_cast<size_t>(cols_) * rows_ + 1, 0);
+    for (const auto& entry : entries_) {
+        cellStart_[cellY(entry.position.y) * cols_ + cellX(entry.position.x) + 1]++;
+    }
+    for (size_t i = 1; i < cellStart_.size(); ++i) {
+        cellStart_[i] += cellStart_[i - 1];
+    }
+    cellEntries_.resize(indexed_);
+    scatterCursor_.assign(cellStart_.begin(), cellStart_.end() - 1);
+    for (const auto& entry : entries_) {
+        int cell = cellY(entry.position.y) * cols_ + cellX(entry.position.x);
+        cellEntries_[scatterCursor_[cell]++] = entry;
+    }
+    // Buckets are short; stable insertion sort of each one by descending key
+    for (size_t cell = 0; cell + 1 < cellStart_.size(); ++cell) {
+        for (int i = cellStart_[cell] + 1; i < cellStart_[cell + 1]; ++i) {
+            Entry entry = cellEntries_[i];
+            int j = i - 1;
+            while (j >= cellStart_[cell] && cellEntries_[j].key < entry.key) {
+                cellEntries_[j + 1] = cellEntries_[j];
+                --j;
+            }
+            cellEntries_[j + 1] = entry;
+        }
+    }
+}
+int SpatialHash::cellX(float x) const {
+    int cx = static_cast<int>(std::floor((x - origin_.x) * invCellSize_));
+    return std::max(0, std::min(cols_ - 1, cx));
+}
+int SpatialHash::cellY(float y) const {
+    int cy = static_cast<int>(std::floor((y - origin_.y) * invCellSize_));
+    return std::max(0, std::min(rows_ - 1, cy));
+}
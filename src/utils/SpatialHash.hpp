@@ -0,0 +1,125 @@
+#pragma once
+#include <SFML/System/Vector2.hpp>
+#include <vector>
+#include <cstddef>
+// Uniform cell grid over the bounding box of the inserted points.
+// rebuild() buckets entries with a counting sort so a query only touches
+// the cells its circle overlaps. Entries inserted after the last rebuild
+// are kept in a short pending list and scanned linearly until the next one.
+// Each entry carries a sort key; buckets are ordered by it (highest first)
+// so queryExtreme() can stop at the first hit in a cell.
+class SpatialHash {
+public:
+    SpatialHash(float cellSize = 64.0f, int maxCellsPerAxis = 256);
+    void clear();
+    void insert(int id, const sf::Vector2f& position, float key = 0.0f);
+    void rebuild();
+    // Calls fn(id) for every entry whose position is within radius of center;
+    // fn returns false to stop the query early
+    template<typename Fn>
+    void query(const sf::Vector2f& center, float radius, Fn&& fn) const;
+    // Id of the entry within radius that passes accept(id) with the highest
+    // key (lowest if !highest), or -1. Ties keep the first one found. Each
+    // bucket is walked from its best end and abandoned once keys get worse
+    // than the current winner.
+    template<typename Accept>
+    int queryExtreme(const sf::Vector2f& center, float radius, bool highest, Accept&& accept) const;
+    size_t size() const { return entries_.size(); }
+    float getCellSize() const { return cellSize_; }
+    int getColumns() const { return cols_; }
+    int getRows() const { return rows_; }
+private:
+    struct Entry {
+        int id;
+        sf::Vector2f position;
+        float key;
+    };
+    int cellX(float x) const;
+    int cellY(float y) const;
+    float cellSize_;
+    float invCellSize_;
+    int maxCellsPerAxis_;
+    sf::Vector2f origin_;
+    int cols_ = 0;
+    int rows_ = 0;
+    std::vector<Entry> entries_;     // insertion order, [0, indexed_) are bucketed
+    size_t indexed_ = 0;
+    std::vector<int> cellStart_;     // cols_ * rows_ + 1 prefix offsets into cellEntries_
+    std::vector<Entry> cellEntries_; // entries sorted by cell, then by descending key
+    std::vector<int> scatterCursor_;
+};
+
+template<typename Fn>
+void SpatialHash::query(const sf::Vector2f& center, float radius, Fn&& fn) const {
+    float radiusSq = radius * radius;
+    if (indexed_ > 0) {
+        int minX = cellX(center.x - radius);
+        int maxX = cellX(center.x + radius);
+        int minY = cellY(center.y - radius);
+        int maxY = cellY(center.y + radius);
+        for (int y = minY; y <= maxY; ++y) {
+            for (int x = minX; x <= maxX; ++x) {
+                int cell = y * cols_ + x;
+                for (int i = cellStart_[cell]; i < cellStart_[cell + 1]; ++i) {
+                    const Entry& entry = cellEntries_[i];
+                    float dx = entry.position.x - center.x;
+                    float dy = entry.position.y - center.y;
+                    if (dx * dx + dy * dy <= radiusSq && !fn(entry.id)) return;
+                }
+            }
+        }
+    }
+    for (size_t i = indexed_; i < entries_.size(); ++i) {
+        const Entry& entry = entries_[i];
+        float dx = entry.position.x - center.x;
+        float dy = entry.position.y - center.y;
+        if (dx * dx + dy * dy <= radiusSq && !fn(entry.id)) return;
+    }
+}
+
+template<typename Accept>
+int SpatialHash::queryExtreme(const sf::Vector2f& center, float radius, bool highest, Accept&& accept) const {
+    float radiusSq = radius * radius;
+    int bestId = -1;
+    float bestKey = 0.0f;
+    auto worse = [&](const Entry& entry) {
+        return bestId >= 0 && (highest ? entry.key < bestKey : entry.key > bestKey);
+    };
+    auto consider = [&](const Entry& entry) {
+        if (bestId >= 0 && entry.key == bestKey) return false;
+        float dx = entry.position.x - center.x;
+        float dy = entry.position.y - center.y;
+        if (dx * dx + dy * dy > radiusSq || !accept(entry.id)) return false;
+        bestId = entry.id;
+        bestKey = entry.key;
+        return true;
+    };
+    if (indexed_ > 0) {
+        int minX = cellX(center.x - radius);
+        int maxX = cellX(center.x + radius);
+        int minY = cellY(center.y - radius);
+        int maxY = cellY(center.y + radius);
+        for (int y = minY; y <= maxY; ++y) {
+            for (int x = minX; x <= maxX; ++x) {
+                int cell = y * cols_ + x;
+                int begin = cellStart_[cell];
+                int end = cellStart_[cell + 1];
+                if (begin == end) continue;
+                // Walk from the best end of the bucket; the first accepted entry is this cell's winner
+                if (highest) {
+                    for (int i = begin; i < end && !worse(cellEntries_[i]); ++i) {
+                        if (consider(cellEntries_[i])) break;
+                    }
+                } else {
+                    for (int i = end - 1; i >= begin && !worse(cellEntries_[i]); --i) {
+                        if (consider(cellEntries_[i])) break;
+                    }
+                }
+            }
+        }
+    }
+    for (size_t i = indexed_; i < entries_.size(); ++i) {
+        if (!worse(entries_[i])) consider(entries_[i]);
+    }
+    return bestId;
+}
@@ -0,0 +1,301 @@
+// Monte Carlo balance runner: plays many seeded, window-free Simulations of
+// each tower layout in a config across all cores and writes one row per run
+// (lives lost, gold after each wave, kills per tower/unit type, simulated time).
+// Each run owns its Simulation and generators, so threads share nothing mutable.
+// Layouts play through SimulationScript, as HeadlessRunner scripts do. --check
+// replays each layout's first seed with a ParticleSystem attached, as the
+// windowed game has, and fails unless lives and gold come out the same.
+//
+// Build from the repo root alongside the game sources, e.g.
+//   g++ -std=c++17 -O2 -pthread -Isrc tools/BalanceRunner.cpp src/core/Simulation.cpp src/core/SimulationScript.cpp
+//       src/core/EventBus.cpp src/systems/EnemySystem.cpp src/systems/UnitSystem.cpp
+//       src/systems/TowerSystem.cpp src/systems/ProjectileSystem.cpp src/systems/ParticleSystem.cpp
+//       src/systems/CollisionSystem.cpp src/systems/WaveSystem.cpp src/systems/PathfindingSystem.cpp
+//       src/systems/UpgradeSystem.cpp src/systems/SaveLoadSystem.cpp src/systems/StatusEffectSystem.cpp
+//       src/systems/Grid.cpp src/systems/FlowField.cpp src/systems/HierarchicalPathfinder.cpp
+//       src/systems/PathRequestQueue.cpp src/systems/PathRegistry.cpp src/systems/ProjectileKinematics.cpp
+//       src/entities/*.cpp src/components/SpriteComp.cpp src/utils/*.cpp
+//       src/json/JSONLoader.cpp src/maps/Map.cpp -lsfml-graphics -lsfml-window -lsfml-system
+// Usage:
+//   BalanceRunner [tools/balance.json] [--runs N] [--threads N] [--seed S] [--jitter F]
+//                 [--csv out.csv] [--json out.json] [--check]
+#include "../src/core/Simulation.hpp"
+#include "../src/core/SimulationScript.hpp"
+#include "../src/core/EventBus.hpp"
+#include "../src/core/GameEvents.hpp"
+#include "../src/systems/WaveSystem.hpp"
+#include "../src/systems/ParticleSystem.hpp"
+#include "../src/json/json.hpp"
+#include "../src/utils/QuietLog.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using json = nlohmann::json;
+
+namespace {
+
+struct Layout {
+    std::string name;
+    std::string map;
+    int waveLimit;  // 0 = every wave in waves.json
+    SimulationScript script;
+};
+
+struct Config {
+    float tickRate = 60.0f;
+    long long maxTicks = 1000000;
+    int runsPerLayout = 64;
+    float spawnJitter = 0.15f;
+    uint32_t seed = 1;
+    int threads = 0;
+    std::string csvPath = "balance.csv";
+    std::string jsonPath;
+    std::vector<Layout> layouts;
+};
+
+struct RunResult {
+    size_t layout = 0;
+    uint32_t seed = 0;
+    std::string outcome;
+    bool loaded = true;          // false if the game data or map failed to load
+    int wavesCleared = 0;
+    int livesLost = 0;
+    int finalGold = 0;
+    double simSeconds = 0.0;
+    double wallMs = 0.0;
+    std::vector<int> goldCurve;  // gold right after each cleared wave
+    std::map<std::string, int> kills;
+};
+
+bool loadConfig(const std::string& path, Config& config) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "[Balance] ERROR: Cannot open config: " << path << std::endl;
+        return false;
+    }
+    try {
+        json data;
+        file >> data;
+        config.tickRate = data.value("tick_rate", config.tickRate);
+        config.maxTicks = data.value("max_ticks", config.maxTicks);
+        config.runsPerLayout = data.value("runs_per_layout", config.runsPerLayout);
+        config.spawnJitter = data.value("spawn_jitter", config.spawnJitter);
+        config.seed = data.value("seed", config.seed);
+        for (const auto& entry : data.at("layouts")) {
+            Layout layout;
+            layout.name = entry.value("name", std::string("layout") + std::to_string(config.layouts.size()));
+            layout.map = entry.value("map", std::string("forest_path"));
+            layout.waveLimit = entry.value("waves", 0);
+            layout.script.loadPlacements(entry.value("placements", json::array()));
+            config.layouts.push_back(layout);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "[Balance] ERROR: Invalid config " << path << ": " << e.what() << std::endl;
+        return false;
+    }
+    return !config.layouts.empty();
+}
+
+// particles: attached the way Game attaches its own, for --check
+RunResult runOne(const Config& config, size_t layoutIndex, uint32_t seed, ParticleSystem* particles = nullptr) {
+    const Layout& layout = config.layouts[layoutIndex];
+    RunResult result;
+    result.layout = layoutIndex;
+    result.seed = seed;
+
+    auto start = std::chrono::steady_clock::now();
+    Simulation simulation;
+    if (particles) simulation.setParticleSystem(particles);
+    // Without data every run would tick to max_ticks and count as cleared
+    // (0 of 0 waves), so report the failure instead
+    if (!simulation.initialize(layout.map) || simulation.getTotalWaves() == 0) {
+        result.loaded = false;
+        result.outcome = "error";
+        return result;
+    }
+    simulation.getWaveSystem()->setSpawnJitter(config.spawnJitter, seed);
+    const int startLives = simulation.getLives();
+
+    simulation.getEventBus()->subscribe(Events::ENEMY_DIED, [&result](const std::string&, void* data) {
+        EnemyEventData* eventData = static_cast<EnemyEventData*>(data);
+        if (eventData) result.kills[eventData->killedBy.empty() ? "other" : eventData->killedBy]++;
+    });
+    // Simulation credits the wave reward before publishing, so getGold() already includes it
+    simulation.getEventBus()->subscribe(Events::WAVE_COMPLETED, [&result, &simulation](const std::string&, void*) {
+        result.goldCurve.push_back(simulation.getGold());
+    });
+
+    int waveLimit = simulation.getTotalWaves();
+    if (layout.waveLimit > 0) waveLimit = std::min(waveLimit, layout.waveLimit);
+
+    const float dt = 1.0f / config.tickRate;
+    layout.script.play(simulation, dt, config.maxTicks, waveLimit);
+
+    result.wavesCleared = simulation.getCurrentWave();
+    result.livesLost = startLives - std::max(simulation.getLives(), 0);
+    result.finalGold = simulation.getGold();
+    result.simSeconds = simulation.getTickCount() * dt;
+    result.outcome = simulation.isDefeat() ? "defeat"
+                   : result.wavesCleared >= waveLimit ? "victory"
+                   : "tick_limit";
+    result.wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+std::string joinGold(const std::vector<int>& curve) {
+    std::ostringstream out;
+    for (size_t i = 0; i < curve.size(); ++i) out << (i ? ";" : "") << curve[i];
+    return out.str();
+}
+
+std::string joinKills(const std::map<std::string, int>& kills) {
+    std::ostringstream out;
+    bool first = true;
+    for (const auto& kill : kills) {
+        out << (first ? "" : ";") << kill.first << "=" << kill.second;
+        first = false;
+    }
+    return out.str();
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::string configPath = "tools/balance.json";
+    Config config;
+    int runsOverride = 0;
+    float jitterOverride = -1.0f;
+    long long seedOverride = -1;
+    std::string csvPath, jsonPath;
+    bool check = false;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--runs" && hasValue) runsOverride = std::atoi(argv[++i]);
+        else if (arg == "--threads" && hasValue) config.threads = std::atoi(argv[++i]);
+        else if (arg == "--seed" && hasValue) seedOverride = std::atoll(argv[++i]);
+        else if (arg == "--jitter" && hasValue) jitterOverride = static_cast<float>(std::atof(argv[++i]));
+        else if (arg == "--csv" && hasValue) csvPath = argv[++i];
+        else if (arg == "--json" && hasValue) jsonPath = argv[++i];
+        else if (arg == "--check") check = true;
+        else if (arg[0] != '-') configPath = arg;
+    }
+    if (!loadConfig(configPath, config)) return 1;
+    if (runsOverride > 0) config.runsPerLayout = runsOverride;
+    if (jitterOverride >= 0.0f) config.spawnJitter = jitterOverride;
+    if (seedOverride >= 0) config.seed = static_cast<uint32_t>(seedOverride);
+    if (!csvPath.empty()) config.csvPath = csvPath;
+    if (!jsonPath.empty()) config.jsonPath = jsonPath;
+    if (config.tickRate <= 0.0f) config.tickRate = 60.0f;
+    int threadCount = config.threads > 0 ? config.threads
+                                         : std::max(1u, std::thread::hardware_concurrency());
+
+    const size_t totalRuns = config.layouts.size() * static_cast<size_t>(config.runsPerLayout);
+    std::vector<RunResult> results(totalRuns);
+    std::atomic<size_t> nextRun(0);
+
+    // The systems log freely; keep it out of the table (and off the workers' clocks)
+    QuietLog quiet;
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threadCount; ++t) {
+        workers.emplace_back([&]() {
+            for (size_t run = nextRun++; run < totalRuns; run = nextRun++) {
+                size_t layout = run / config.runsPerLayout;
+                uint32_t seed = config.seed + static_cast<uint32_t>(run % config.runsPerLayout);
+                results[run] = runOne(config, layout, seed);
+            }
+        });
+    }
+    for (auto& worker : workers) worker.join();
+    double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    // Particles are visual only; a layout that plays differently with them
+    // means these rows don't describe the game people play
+    std::vector<RunResult> windowed;
+    if (check) {
+        for (size_t l = 0; l < config.layouts.size(); ++l) {
+            ParticleSystem particles;
+            windowed.push_back(runOne(config, l, config.seed, &particles));
+        }
+    }
+    quiet.restore();
+
+    for (const auto& r : results) {
+        if (!r.loaded) {
+            std::cerr << "[Balance] ERROR: Game data failed to load for layout '" << config.layouts[r.layout].name
+                      << "' (map " << config.layouts[r.layout].map << "); run from the repo root" << std::endl;
+            return 1;
+        }
+    }
+
+    bool matched = true;
+    for (size_t l = 0; l < windowed.size(); ++l) {
+        const RunResult& plain = results[l * config.runsPerLayout];
+        const RunResult& window = windowed[l];
+        bool same = plain.wavesCleared == window.wavesCleared && plain.livesLost == window.livesLost &&
+                    plain.finalGold == window.finalGold;
+        std::cout << "[Balance] check " << config.layouts[l].name << " seed " << config.seed << ": "
+                  << (same ? "same" : "DIFFERS") << " (lives lost " << plain.livesLost << "/" << window.livesLost
+                  << ", gold " << plain.finalGold << "/" << window.finalGold << ", runner/windowed)" << std::endl;
+        matched = matched && same;
+    }
+    if (!matched) {
+        std::cerr << "[Balance] ERROR: runs differ from the windowed configuration" << std::endl;
+        return 1;
+    }
+
+    std::ofstream csv(config.csvPath);
+    csv << "layout,map,seed,outcome,waves_cleared,lives_lost,final_gold,sim_seconds,wall_ms,gold_curve,kills\n";
+    for (const auto& r : results) {
+        const Layout& layout = config.layouts[r.layout];
+        csv << layout.name << "," << layout.map << "," << r.seed << "," << r.outcome << ","
+            << r.wavesCleared << "," << r.livesLost << "," << r.finalGold << ","
+            << r.simSeconds << "," << r.wallMs << "," << joinGold(r.goldCurve) << "," << joinKills(r.kills) << "\n";
+    }
+
+    if (!config.jsonPath.empty()) {
+        json runs = json::array();
+        for (const auto& r : results) {
+            runs.push_back({
+                {"layout", config.layouts[r.layout].name}, {"map", config.layouts[r.layout].map},
+                {"seed", r.seed}, {"outcome", r.outcome}, {"waves_cleared", r.wavesCleared},
+                {"lives_lost", r.livesLost}, {"final_gold", r.finalGold},
+                {"sim_seconds", r.simSeconds}, {"wall_ms", r.wallMs},
+                {"gold_curve", r.goldCurve}, {"kills", r.kills}
+            });
+        }
+        std::ofstream out(config.jsonPath);
+        out << json({{"threads", threadCount}, {"wall_seconds", wallSeconds}, {"runs", runs}}).dump(2) << "\n";
+    }
+
+    std::cout << "layout" << std::string(14, ' ') << "runs  win%   lives lost  sim s/run" << std::endl;
+    for (size_t l = 0; l < config.layouts.size(); ++l) {
+        int wins = 0;
+        double lives = 0.0, sim = 0.0;
+        for (int i = 0; i < config.runsPerLayout; ++i) {
+            const RunResult& r = results[l * config.runsPerLayout + i];
+            wins += r.outcome == "victory";
+            lives += r.livesLost;
+            sim += r.simSeconds;
+        }
+        double n = config.runsPerLayout;
+        std::cout << std::left << std::setw(20) << config.layouts[l].name << std::right
+                  << std::setw(4) << config.runsPerLayout << std::fixed << std::setprecision(1)
+                  << std::setw(6) << (100.0 * wins / n) << std::setw(13) << (lives / n)
+                  << std::setw(11) << (sim / n) << std::endl;
+    }
+    std::cout << std::setprecision(2) << totalRuns << " runs on " << threadCount << " threads in "
+              << wallSeconds << "s (" << (totalRuns / wallSeconds) << " runs/s) -> " << config.csvPath
+              << (config.jsonPath.empty() ? "" : ", " + config.jsonPath) << std::endl;
+    return 0;
+}